@@ -0,0 +1,20 @@
+#pragma once
+
+#include <span>
+#include <string_view>
+#include <cstddef>
+
+namespace NAds::NAlgo::NBytes {
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Bytes as chars without copying, e.g. of a memory mapped file for a search
+// which takes std::string_view
+[[nodiscard]] inline std::string_view asStringView(
+    std::span<const std::byte> bytes) noexcept {
+  return {reinterpret_cast<const char*>(bytes.data()), bytes.size()};
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace NAds::NAlgo::NBytes
@@ -0,0 +1,240 @@
+#include "big_gcd.hpp"
+#include "euclidean.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <utility>
+
+namespace NAds::NAlgo::NEuclidean {
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+
+__extension__ using TUint128 = unsigned __int128;
+__extension__ using TInt128 = __int128;
+
+using TLimbs = std::vector<std::uint64_t>;
+
+// Leading bits simulated by one Lehmer step. Cofactors stay below 2^62, so
+// sums x + A of the quotient test fit into int64
+constexpr int LeadingBits = 62;
+
+void trim(TLimbs& x) {
+  while (!x.empty() && x.back() == 0) {
+    x.pop_back();
+  }
+}
+
+[[nodiscard]] TLimbs normalized(std::span<const std::uint64_t> x) {
+  TLimbs result(x.begin(), x.end());
+  trim(result);
+  return result;
+}
+
+// Both arguments are trimmed
+[[nodiscard]] bool isLess(const TLimbs& a, const TLimbs& b) {
+  if (a.size() != b.size()) {
+    return a.size() < b.size();
+  }
+  return std::lexicographical_compare(a.rbegin(), a.rend(), b.rbegin(),
+                                      b.rend());
+}
+
+[[nodiscard]] std::uint64_t bitLength(const TLimbs& x) {
+  return x.empty() ? 0
+                   : x.size() * 64 - static_cast<std::uint64_t>(
+                                         std::countl_zero(x.back()));
+}
+
+// Bits [shift, shift + 64) of x
+[[nodiscard]] std::uint64_t bitsAt(const TLimbs& x, std::uint64_t shift) {
+  const std::size_t limb = shift / 64;
+  const auto offset = static_cast<int>(shift % 64);
+  const std::uint64_t low = limb < x.size() ? x[limb] >> offset : 0;
+  const std::uint64_t high =
+      (offset != 0 && limb + 1 < x.size()) ? x[limb + 1] << (64 - offset) : 0;
+  return low | high;
+}
+
+// x mod divisor for a single-limb divisor
+[[nodiscard]] std::uint64_t modLimb(const TLimbs& x, std::uint64_t divisor) {
+  std::uint64_t remainder = 0;
+  for (std::size_t i = x.size(); i > 0; --i) {
+    remainder = static_cast<std::uint64_t>(
+        ((static_cast<TUint128>(remainder) << 64) | x[i - 1]) % divisor);
+  }
+  return remainder;
+}
+
+// x * 2^shift for shift < 64 as a number of size limbs
+[[nodiscard]] TLimbs shiftedLeft(const TLimbs& x, int shift,
+                                 std::size_t size) {
+  TLimbs result(size, 0);
+  std::uint64_t carry = 0;
+  for (std::size_t i = 0; i < x.size(); ++i) {
+    result[i] = (x[i] << shift) | carry;
+    carry = shift == 0 ? 0 : x[i] >> (64 - shift);
+  }
+  if (x.size() < size) {
+    result[x.size()] = carry;
+  }
+  return result;
+}
+
+// a mod b for b with at least 2 limbs, Knuth's algorithm D. Both operands are
+// shifted so that the top bit of b is set, then every quotient limb is
+// estimated from the top limbs and is too large by at most one after the
+// correction loop.
+[[nodiscard]] TLimbs modLong(const TLimbs& a, const TLimbs& b) {
+  if (isLess(a, b)) {
+    return a;
+  }
+  const std::size_t n = b.size();
+  const std::size_t m = a.size() - n;
+  const int shift = std::countl_zero(b.back());
+  const TLimbs v = shiftedLeft(b, shift, n);
+  TLimbs u = shiftedLeft(a, shift, a.size() + 1);
+  const std::uint64_t v_top = v[n - 1];
+  const std::uint64_t v_next = v[n - 2];
+  for (std::size_t j = m + 1; j-- > 0;) {
+    const TUint128 numerator =
+        (static_cast<TUint128>(u[j + n]) << 64) | u[j + n - 1];
+    TUint128 q_hat = numerator / v_top;
+    TUint128 r_hat = numerator % v_top;
+    while ((q_hat >> 64) != 0 ||
+           q_hat * v_next > ((r_hat << 64) | u[j + n - 2])) {
+      --q_hat;
+      r_hat += v_top;
+      if ((r_hat >> 64) != 0) {
+        break;
+      }
+    }
+    // u[j, j + n] -= q_hat * v
+    const auto q = static_cast<std::uint64_t>(q_hat);
+    std::uint64_t carry = 0;
+    std::uint64_t borrow = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+      const TUint128 product = static_cast<TUint128>(q) * v[i] + carry;
+      carry = static_cast<std::uint64_t>(product >> 64);
+      const TUint128 diff = static_cast<TUint128>(u[i + j]) -
+                            static_cast<std::uint64_t>(product) - borrow;
+      u[i + j] = static_cast<std::uint64_t>(diff);
+      borrow = (diff >> 64) != 0 ? 1 : 0;
+    }
+    const TUint128 top = static_cast<TUint128>(u[j + n]) - carry - borrow;
+    u[j + n] = static_cast<std::uint64_t>(top);
+    if ((top >> 64) != 0) {
+      // q_hat was one too large, add v back
+      std::uint64_t add_carry = 0;
+      for (std::size_t i = 0; i < n; ++i) {
+        const TUint128 sum =
+            static_cast<TUint128>(u[i + j]) + v[i] + add_carry;
+        u[i + j] = static_cast<std::uint64_t>(sum);
+        add_carry = static_cast<std::uint64_t>(sum >> 64);
+      }
+      u[j + n] += add_carry;
+    }
+  }
+  TLimbs remainder(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    remainder[i] =
+        (u[i] >> shift) | (shift == 0 ? 0 : u[i + 1] << (64 - shift));
+  }
+  trim(remainder);
+  return remainder;
+}
+
+// out = cx * x + cy * y for y <= x and nonnegative result. Cofactors of one
+// Lehmer step have opposite signs, so the limb sums fit into int128
+void combine(const TLimbs& x, const TLimbs& y, std::int64_t cx,
+             std::int64_t cy, TLimbs& out) {
+  out.assign(x.size(), 0);
+  TInt128 carry = 0;
+  for (std::size_t i = 0; i < x.size(); ++i) {
+    const std::uint64_t y_limb = i < y.size() ? y[i] : 0;
+    const TInt128 sum = static_cast<TInt128>(cx) * x[i] +
+                        static_cast<TInt128>(cy) * y_limb + carry;
+    out[i] = static_cast<std::uint64_t>(sum);
+    carry = sum >> 64;
+  }
+  trim(out);
+}
+
+// gcd(x, y) for y with at most one limb
+[[nodiscard]] TLimbs finishGcd(const TLimbs& x, const TLimbs& y) {
+  if (y.empty()) {
+    return x;
+  }
+  const std::uint64_t result = gcd(y[0], modLimb(x, y[0]));
+  return TLimbs{result};
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+[[nodiscard]] std::vector<std::uint64_t> bigGcd(
+    std::span<const std::uint64_t> a, std::span<const std::uint64_t> b) {
+  TLimbs x = normalized(a);
+  TLimbs y = normalized(b);
+  if (isLess(x, y)) {
+    std::swap(x, y);
+  }
+  TLimbs next_x;
+  TLimbs next_y;
+  while (y.size() > 1) {
+    // x >= y >= 2^64, so the leading bits of x are a full LeadingBits word
+    const std::uint64_t shift = bitLength(x) - LeadingBits;
+    auto lead_x = static_cast<std::int64_t>(bitsAt(x, shift));
+    auto lead_y = static_cast<std::int64_t>(bitsAt(y, shift));
+    // Euclid on the leading words while the quotient is the same for both
+    // ends of the cofactor interval, so it is the quotient of x and y too
+    // (Knuth, TAOCP 4.5.2, algorithm L)
+    std::int64_t ca = 1;
+    std::int64_t cb = 0;
+    std::int64_t cc = 0;
+    std::int64_t cd = 1;
+    while (lead_y + cc != 0 && lead_y + cd != 0) {
+      const std::int64_t quotient = (lead_x + ca) / (lead_y + cc);
+      if (quotient != (lead_x + cb) / (lead_y + cd)) {
+        break;
+      }
+      ca = std::exchange(cc, ca - quotient * cc);
+      cb = std::exchange(cd, cb - quotient * cd);
+      lead_x = std::exchange(lead_y, lead_x - quotient * lead_y);
+    }
+    if (cb == 0) {
+      // Not a single quotient is known, take one full division step
+      TLimbs remainder = modLong(x, y);
+      x = std::move(y);
+      y = std::move(remainder);
+      continue;
+    }
+    combine(x, y, ca, cb, next_x);
+    combine(x, y, cc, cd, next_y);
+    std::swap(x, next_x);
+    std::swap(y, next_y);
+  }
+  return finishGcd(x, y);
+}
+
+[[nodiscard]] std::vector<std::uint64_t> bigGcdEuclid(
+    std::span<const std::uint64_t> a, std::span<const std::uint64_t> b) {
+  TLimbs x = normalized(a);
+  TLimbs y = normalized(b);
+  while (y.size() > 1) {
+    TLimbs remainder = modLong(x, y);
+    x = std::move(y);
+    y = std::move(remainder);
+  }
+  return finishGcd(x, y);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace NAds::NAlgo::NEuclidean
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <vector>
+#include <span>
+#include <cstdint>
+
+namespace NAds::NAlgo::NEuclidean {
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Multi-precision unsigned integers are little-endian spans of 64-bit limbs.
+// Leading zero limbs are allowed in arguments, results have none, so zero is
+// an empty vector.
+
+// gcd by Lehmer's algorithm. Quotients are simulated on the leading 62 bits
+// of both numbers with single-precision cofactors, then one pass over the
+// limbs applies all steps found so far. A full division is done only when
+// the leading bits do not determine even one quotient.
+[[nodiscard]] std::vector<std::uint64_t> bigGcd(
+    std::span<const std::uint64_t> a, std::span<const std::uint64_t> b);
+
+// gcd by schoolbook Euclid, a full-width long division per step. Baseline
+// for bigGcd
+[[nodiscard]] std::vector<std::uint64_t> bigGcdEuclid(
+    std::span<const std::uint64_t> a, std::span<const std::uint64_t> b);
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace NAds::NAlgo::NEuclidean
@@ -0,0 +1,53 @@
+#ifndef ADS_ALGO_EUCLIDEAN_EUCLIDEAN_INL_HPP_
+#error "Direct inclusion of this file is not allowed, include euclidean.hpp"
+// For the sake of sane code completion.
+#include "euclidean.hpp"
+#endif
+
+#include <bit>
+#include <type_traits>
+#include <utility>
+
+namespace NAds::NAlgo::NEuclidean {
+
+////////////////////////////////////////////////////////////////////////////////
+
+template <EGcdAlgorithm Algorithm>
+[[nodiscard]] constexpr std::uint64_t gcd(std::uint64_t a, std::uint64_t b) {
+  if constexpr (Algorithm == EGcdAlgorithm::Euclid) {
+    while (b != 0) {
+      a %= b;
+      std::swap(a, b);
+    }
+    return a;
+  } else {
+    if (a == 0 || b == 0) {
+      return a | b;
+    }
+    // gcd(2^i * a', 2^j * b') = 2^min(i, j) * gcd(a', b') for odd a', b'
+    const int shift = std::countr_zero(a | b);
+    b >>= std::countr_zero(b);
+    int a_zeros = std::countr_zero(a);
+    // gcd(a, b) = gcd(|a - b|, min(a, b)), and |a - b| of odd a, b is even.
+    // Zeros of the difference are counted before it is made absolute, so
+    // countr_zero does not wait for the comparison. The comparison selects
+    // by masks: its outcome is random, a branch would be mispredicted. The
+    // empty asm keeps the optimizer from turning the masks into a branch.
+    while (a != 0) {
+      a >>= a_zeros;
+      const std::uint64_t diff = b - a;
+      a_zeros = std::countr_zero(diff);
+      std::uint64_t is_greater = 0 - static_cast<std::uint64_t>(a > b);
+      if (!std::is_constant_evaluated()) {
+        asm("" : "+r"(is_greater));
+      }
+      b -= diff & ~is_greater;
+      a = (diff ^ is_greater) - is_greater;
+    }
+    return b << shift;
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace NAds::NAlgo::NEuclidean
@@ -1,21 +1,238 @@
 #include "euclidean.hpp"
 
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <stdexcept>
 #include <utility>
 
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define ADS_ALGO_EUCLIDEAN_EUCLIDEAN_AVX512
+#endif
+
 namespace NAds::NAlgo::NEuclidean {
 
 ////////////////////////////////////////////////////////////////////////////////
 
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+
+__extension__ using TUint128 = unsigned __int128;
+
+// Pairs processed by one call of a lanes kernel
+constexpr std::size_t LanesCount = 8;
+
+// out[i] = gcd(a[i], b[i]) for i < LanesCount, out may alias a or b
+void gcdLanesScalar(const std::uint64_t* a, const std::uint64_t* b,
+                    std::uint64_t* out) {
+  for (std::size_t i = 0; i < LanesCount; ++i) {
+    out[i] = gcd(a[i], b[i]);
+  }
+}
+
+#ifdef ADS_ALGO_EUCLIDEAN_EUCLIDEAN_AVX512
+// Trailing zeros of 64-bit lanes by leading zeros of the lowest set bit.
+// Zero lanes give 2^64 - 1, which shifts a lane out completely.
+__attribute__((target("avx512f,avx512cd"))) __m512i countrZeroAvx512(
+    __m512i x) {
+  const __m512i lowest_bit =
+      _mm512_and_si512(x, _mm512_sub_epi64(_mm512_setzero_si512(), x));
+  return _mm512_sub_epi64(_mm512_set1_epi64(63),
+                          _mm512_lzcnt_epi64(lowest_bit));
+}
+
+// Binary gcd of gcd<EGcdAlgorithm::Binary> on 8 lanes. Lanes run in lockstep,
+// finished lanes are frozen by the mask until the slowest lane finishes.
+__attribute__((target("avx512f,avx512cd"))) void gcdLanesAvx512(
+    const std::uint64_t* a, const std::uint64_t* b, std::uint64_t* out) {
+  const __m512i zero = _mm512_setzero_si512();
+  __m512i lanes_a = _mm512_loadu_si512(a);
+  __m512i lanes_b = _mm512_loadu_si512(b);
+  const __mmask8 has_zero = _mm512_cmpeq_epi64_mask(lanes_a, zero) |
+                            _mm512_cmpeq_epi64_mask(lanes_b, zero);
+  const __m512i both = _mm512_or_si512(lanes_a, lanes_b);
+  // gcd(x, 0) = x is returned as is
+  const __m512i shift =
+      _mm512_mask_mov_epi64(countrZeroAvx512(both), has_zero, zero);
+  lanes_b = _mm512_srlv_epi64(lanes_b, countrZeroAvx512(lanes_b));
+  lanes_b = _mm512_mask_mov_epi64(lanes_b, has_zero, both);
+  lanes_a = _mm512_mask_mov_epi64(lanes_a, has_zero, zero);
+  for (__mmask8 active = _mm512_test_epi64_mask(lanes_a, lanes_a); active != 0;
+       active = _mm512_test_epi64_mask(lanes_a, lanes_a)) {
+    lanes_a = _mm512_srlv_epi64(lanes_a, countrZeroAvx512(lanes_a));
+    const __m512i min = _mm512_min_epu64(lanes_a, lanes_b);
+    const __m512i max = _mm512_max_epu64(lanes_a, lanes_b);
+    lanes_b = _mm512_mask_mov_epi64(lanes_b, active, min);
+    lanes_a = _mm512_mask_sub_epi64(lanes_a, active, max, min);
+  }
+  _mm512_storeu_si512(out, _mm512_sllv_epi64(lanes_b, shift));
+}
+#endif
+
+using TGcdLanes = void (*)(const std::uint64_t*, const std::uint64_t*,
+                           std::uint64_t*);
+
+[[nodiscard]] TGcdLanes selectGcdLanes() {
+#ifdef ADS_ALGO_EUCLIDEAN_EUCLIDEAN_AVX512
+  if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512cd")) {
+    return gcdLanesAvx512;
+  }
+#endif
+  return gcdLanesScalar;
+}
+
+[[nodiscard]] TGcdLanes gcdLanes() {
+  static const TGcdLanes gcd_lanes = selectGcdLanes();
+  return gcd_lanes;
+}
+
+[[nodiscard]] std::uint64_t mulMod(std::uint64_t a, std::uint64_t b,
+                                   std::uint64_t modulus) {
+  return static_cast<std::uint64_t>(static_cast<TUint128>(a) * b % modulus);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
 std::uint64_t gcd(std::uint64_t a, std::uint64_t b) {
+  return gcd<DefaultGcdAlgorithm>(a, b);
+}
+
+std::uint64_t lcm(std::uint64_t a, std::uint64_t b) {
+  if (a == 0 || b == 0) {
+    return 0;
+  }
+  return a / gcd(a, b) * b;
+}
+
+[[nodiscard]] TCheckedLcm checkedLcm(std::uint64_t a, std::uint64_t b) {
+  if (a == 0 || b == 0) {
+    return TCheckedLcm{.Value = 0, .IsSaturated = false};
+  }
+  std::uint64_t value = 0;
+  if (__builtin_mul_overflow(a / gcd(a, b), b, &value)) {
+    return TCheckedLcm{.Value = std::numeric_limits<std::uint64_t>::max(),
+                       .IsSaturated = true};
+  }
+  return TCheckedLcm{.Value = value, .IsSaturated = false};
+}
+
+[[nodiscard]] TCheckedLcm lcmReduce(std::span<const std::uint64_t> values) {
+  // Zero makes the lcm 0 even if a prefix already overflows
+  if (std::find(values.begin(), values.end(), 0) != values.end()) {
+    return TCheckedLcm{.Value = 0, .IsSaturated = false};
+  }
+  TCheckedLcm result{.Value = 1, .IsSaturated = false};
+  for (const std::uint64_t& value : values) {
+    result = checkedLcm(result.Value, value);
+    if (result.IsSaturated) {
+      break;
+    }
+  }
+  return result;
+}
+
+// Coefficients are computed modulo 2^64. Their true values fit into int64,
+// so the wrapped ones convert back exactly.
+[[nodiscard]] TExtendedGcd extendedGcd(std::uint64_t a, std::uint64_t b) {
+  std::uint64_t x = 1;
+  std::uint64_t y = 0;
+  std::uint64_t next_x = 0;
+  std::uint64_t next_y = 1;
   while (b != 0) {
-    a %= b;
+    const std::uint64_t quotient = a / b;
+    a -= quotient * b;
     std::swap(a, b);
+    x -= quotient * next_x;
+    std::swap(x, next_x);
+    y -= quotient * next_y;
+    std::swap(y, next_y);
   }
-  return a;
+  return TExtendedGcd{.Gcd = a,
+                      .X = static_cast<std::int64_t>(x),
+                      .Y = static_cast<std::int64_t>(y)};
 }
 
-std::uint64_t lcm(std::uint64_t a, std::uint64_t b) {
-  return (a * b) / gcd(a, b);
+[[nodiscard]] std::uint64_t modInverse(std::uint64_t a, std::uint64_t modulus) {
+  if (modulus == 0) {
+    throw std::range_error("Modulus must be greater than zero");
+  }
+  const TExtendedGcd result = extendedGcd(a % modulus, modulus);
+  if (result.Gcd != 1) {
+    throw std::range_error("Argument is not invertible modulo modulus");
+  }
+  const auto inverse = static_cast<std::uint64_t>(result.X);
+  return result.X < 0 ? inverse + modulus : inverse;
+}
+
+void modInverseBatch(std::span<const std::uint64_t> values,
+                     std::uint64_t modulus, std::span<std::uint64_t> out) {
+  if (values.size() != out.size()) {
+    throw std::range_error("Spans must have equal sizes");
+  }
+  if (modulus == 0) {
+    throw std::range_error("Modulus must be greater than zero");
+  }
+  if (values.empty()) {
+    return;
+  }
+  // Prefix products are kept in out: out[i] = values[0] * ... * values[i]
+  const std::size_t size = values.size();
+  out[0] = values[0] % modulus;
+  for (std::size_t i = 1; i < size; ++i) {
+    out[i] = mulMod(out[i - 1], values[i], modulus);
+  }
+  // inverse of values[0] * ... * values[i]
+  std::uint64_t inverse = modInverse(out[size - 1], modulus);
+  for (std::size_t i = size - 1; i > 0; --i) {
+    out[i] = mulMod(inverse, out[i - 1], modulus);
+    inverse = mulMod(inverse, values[i], modulus);
+  }
+  out[0] = inverse;
+}
+
+void gcdBatch(std::span<const std::uint64_t> a,
+              std::span<const std::uint64_t> b, std::span<std::uint64_t> out) {
+  if (a.size() != b.size() || a.size() != out.size()) {
+    throw std::range_error("Spans must have equal sizes");
+  }
+  const TGcdLanes gcd_lanes = gcdLanes();
+  const std::size_t size = a.size();
+  std::size_t i = 0;
+  for (; i + LanesCount <= size; i += LanesCount) {
+    gcd_lanes(a.data() + i, b.data() + i, out.data() + i);
+  }
+  for (; i < size; ++i) {
+    out[i] = gcd(a[i], b[i]);
+  }
+}
+
+[[nodiscard]] std::uint64_t gcdReduce(std::span<const std::uint64_t> values) {
+  const TGcdLanes gcd_lanes = gcdLanes();
+  const std::size_t size = values.size();
+  // Lane j accumulates gcd of values with indices j modulo LanesCount
+  std::array<std::uint64_t, LanesCount> accumulators{};
+  std::size_t i = 0;
+  for (; i + LanesCount <= size; i += LanesCount) {
+    gcd_lanes(accumulators.data(), values.data() + i, accumulators.data());
+    if (std::find(accumulators.begin(), accumulators.end(), 1) !=
+        accumulators.end()) {
+      return 1;
+    }
+  }
+  std::uint64_t result = 0;
+  for (const std::uint64_t& accumulator : accumulators) {
+    result = gcd(result, accumulator);
+  }
+  for (; i < size && result != 1; ++i) {
+    result = gcd(result, values[i]);
+  }
+  return result;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1,15 +1,79 @@
 #pragma once
 
+#include <span>
 #include <cstdint>
 
 namespace NAds::NAlgo::NEuclidean {
 
 ////////////////////////////////////////////////////////////////////////////////
 
+// a * X + b * Y = Gcd
+struct TExtendedGcd {
+  std::uint64_t Gcd;
+  std::int64_t X;
+  std::int64_t Y;
+};
+
+struct TCheckedLcm {
+  std::uint64_t Value;
+  // lcm exceeds 2^64 - 1, Value is then 2^64 - 1
+  bool IsSaturated;
+};
+
+enum class EGcdAlgorithm {
+  // Remainder loop, one 64-bit division per step
+  Euclid,
+  // Stein's algorithm, subtractions and shifts by std::countr_zero
+  Binary,
+};
+
+inline constexpr EGcdAlgorithm DefaultGcdAlgorithm = EGcdAlgorithm::Binary;
+
+// Algorithm is selected at compile time: gcd<EGcdAlgorithm::Euclid>(a, b)
+template <EGcdAlgorithm Algorithm>
+[[nodiscard]] constexpr std::uint64_t gcd(std::uint64_t a, std::uint64_t b);
+
+// gcd with DefaultGcdAlgorithm
 std::uint64_t gcd(std::uint64_t a, std::uint64_t b);
 
+// a / gcd(a, b) * b, exact whenever lcm fits into uint64. lcm(0, x) = 0
 std::uint64_t lcm(std::uint64_t a, std::uint64_t b);
 
+// lcm saturated at 2^64 - 1, overflow is detected by __builtin_mul_overflow
+[[nodiscard]] TCheckedLcm checkedLcm(std::uint64_t a, std::uint64_t b);
+
+// lcm of all values, 1 for an empty span and 0 if some value is 0. The
+// accumulation stops as soon as the result would overflow
+[[nodiscard]] TCheckedLcm lcmReduce(std::span<const std::uint64_t> values);
+
+// Bezout coefficients satisfy |X| <= max(b / (2 * Gcd), 1) and
+// |Y| <= max(a / (2 * Gcd), 1), so they always fit into int64
+[[nodiscard]] TExtendedGcd extendedGcd(std::uint64_t a, std::uint64_t b);
+
+// x in [0, modulus) such that a * x = 1 (mod modulus). Throws
+// std::range_error if gcd(a, modulus) != 1 or modulus is 0
+[[nodiscard]] std::uint64_t modInverse(std::uint64_t a, std::uint64_t modulus);
+
+// out[i] = modInverse(values[i], modulus) by Montgomery's trick: one
+// modInverse of the product of all values and 3 * n modular multiplications.
+// Throws std::range_error if some value is not invertible. out must not
+// overlap values
+void modInverseBatch(std::span<const std::uint64_t> values,
+                     std::uint64_t modulus, std::span<std::uint64_t> out);
+
+// out[i] = gcd(a[i], b[i]). With AVX-512 binary gcd runs on 8 vector lanes
+// in lockstep, otherwise pairs are processed one by one
+void gcdBatch(std::span<const std::uint64_t> a,
+              std::span<const std::uint64_t> b, std::span<std::uint64_t> out);
+
+// gcd of all values, 0 for an empty span. Vector lanes accumulate gcd of
+// interleaved values, the reduction stops once any of them reaches 1
+[[nodiscard]] std::uint64_t gcdReduce(std::span<const std::uint64_t> values);
+
 ////////////////////////////////////////////////////////////////////////////////
 
 }  // namespace NAds::NAlgo::NEuclidean
+
+#define ADS_ALGO_EUCLIDEAN_EUCLIDEAN_INL_HPP_
+#include "euclidean-inl.hpp"
+#undef ADS_ALGO_EUCLIDEAN_EUCLIDEAN_INL_HPP_
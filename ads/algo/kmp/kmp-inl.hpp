@@ -0,0 +1,158 @@
+#ifndef ADS_ALGO_KMP_KMP_INL_HPP_
+#error "Direct inclusion of this file is not allowed, include kmp.hpp"
+// For the sake of sane code completion.
+#include "kmp.hpp"
+#endif
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+namespace NAds::NAlgo::NKmp {
+
+////////////////////////////////////////////////////////////////////////////////
+
+template <typename TCallback>
+std::size_t TKmpMatcher::scan(std::string_view text, std::size_t match_len,
+                              TCallback&& callback) const {
+  const std::size_t pattern_size = Pattern_.size();
+  const std::size_t text_size = text.size();
+  for (std::size_t i = 0; i < text_size; ++i) {
+    match_len = nextMatchLen(match_len, text[i]);
+    if (match_len == pattern_size) {
+      callback(i + 1);
+      match_len = PrefFunc_[match_len - 1];
+    }
+  }
+  return match_len;
+}
+
+// match_len < pattern size, so Pattern_[match_len] is a valid char
+[[nodiscard]] inline std::size_t TKmpMatcher::nextMatchLen(
+    std::size_t match_len, char c) const noexcept {
+  while (match_len > 0 && c != Pattern_[match_len]) {
+    match_len = PrefFunc_[match_len - 1];
+  }
+  if (c == Pattern_[match_len]) {
+    ++match_len;
+  }
+  return match_len;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+template <std::unsigned_integral TState>
+TKmpDfaMatcher<TState>::TKmpDfaMatcher(std::string pattern)
+    : Pattern_(std::move(pattern)),
+      Table_(createTable(Pattern_)) {
+}
+
+template <std::unsigned_integral TState>
+[[nodiscard]] const std::string& TKmpDfaMatcher<TState>::pattern()
+    const noexcept {
+  return Pattern_;
+}
+
+template <std::unsigned_integral TState>
+[[nodiscard]] std::vector<std::size_t> TKmpDfaMatcher<TState>::findAll(
+    std::string_view text) const {
+  const std::size_t pattern_size = Pattern_.size();
+  std::vector<std::size_t> occurrences;
+  scan(text, 0, [&occurrences, pattern_size](std::size_t end) {
+    occurrences.push_back(end - pattern_size);
+  });
+  return occurrences;
+}
+
+template <std::unsigned_integral TState>
+[[nodiscard]] std::size_t TKmpDfaMatcher<TState>::findFirst(
+    std::string_view text) const noexcept {
+  const std::size_t pattern_size = Pattern_.size();
+  const std::size_t text_size = text.size();
+  std::size_t state = 0;
+  for (std::size_t i = 0; i < text_size; ++i) {
+    state = Table_[state * AlphaSize + static_cast<unsigned char>(text[i])];
+    if (state == pattern_size) {
+      return i + 1 - pattern_size;
+    }
+  }
+  return std::string_view::npos;
+}
+
+template <std::unsigned_integral TState>
+[[nodiscard]] std::size_t TKmpDfaMatcher<TState>::count(
+    std::string_view text) const noexcept {
+  std::size_t occurrences_count = 0;
+  scan(text, 0, [&occurrences_count](std::size_t) { ++occurrences_count; });
+  return occurrences_count;
+}
+
+// The row of the full match continues from the longest proper border, so
+// there is no reset after an occurrence
+template <std::unsigned_integral TState>
+template <typename TCallback>
+TState TKmpDfaMatcher<TState>::scan(std::string_view text, TState state,
+                                    TCallback&& callback) const {
+  const std::size_t pattern_size = Pattern_.size();
+  const std::size_t text_size = text.size();
+  const TState* table = Table_.data();
+  std::size_t curr_state = state;
+  for (std::size_t i = 0; i < text_size; ++i) {
+    curr_state =
+        table[curr_state * AlphaSize + static_cast<unsigned char>(text[i])];
+    if (curr_state == pattern_size) {
+      callback(i + 1);
+    }
+  }
+  return static_cast<TState>(curr_state);
+}
+
+// Row j copies the row of the longest proper border of pattern[0, j), which
+// is tracked as the state of the automaton after pattern[1, j), and only the
+// transition by pattern[j] advances
+template <std::unsigned_integral TState>
+[[nodiscard]] std::vector<TState> TKmpDfaMatcher<TState>::createTable(
+    const std::string& pattern) {
+  const std::size_t pattern_size = pattern.size();
+  if (pattern_size == 0) {
+    throw std::range_error("Pattern must not be empty");
+  }
+  if (pattern_size > MaxPatternSize) {
+    throw std::range_error("Pattern is too long for the state type");
+  }
+  std::vector<TState> table((pattern_size + 1) * AlphaSize, 0);
+  auto row = [&table](std::size_t state) {
+    return table.begin() + static_cast<std::ptrdiff_t>(state * AlphaSize);
+  };
+  auto at = [](const std::string& s, std::size_t ind) {
+    return static_cast<unsigned char>(s[ind]);
+  };
+  row(0)[at(pattern, 0)] = 1;
+  std::size_t border = 0;
+  for (std::size_t j = 1; j <= pattern_size; ++j) {
+    std::copy(row(border), row(border + 1), row(j));
+    if (j < pattern_size) {
+      row(j)[at(pattern, j)] = static_cast<TState>(j + 1);
+      border = row(border)[at(pattern, j)];
+    }
+  }
+  return table;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+template <typename TCallback>
+void TKmpStreamMatcher::feed(std::string_view chunk, TCallback&& callback) {
+  const std::uint64_t chunk_offset = Offset_;
+  const std::uint64_t pattern_size = Matcher_.pattern().size();
+  MatchLen_ = Matcher_.scan(
+      chunk, MatchLen_,
+      [&callback, chunk_offset, pattern_size](std::size_t end) {
+        callback(chunk_offset + end - pattern_size);
+      });
+  Offset_ += chunk.size();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace NAds::NAlgo::NKmp
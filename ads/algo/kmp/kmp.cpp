@@ -1,4 +1,8 @@
 #include "kmp.hpp"
+#include "algo/bytes/bytes.hpp"
+
+#include <stdexcept>
+#include <utility>
 
 namespace NAds::NAlgo::NKmp {
 
@@ -30,28 +34,91 @@ namespace {
 
 ////////////////////////////////////////////////////////////////////////////////
 
-[[nodiscard]] std::vector<std::size_t> kmpSubstrSearch(
-    const std::string& text, const std::string& substr) {
-  const std::size_t substr_size = substr.size();
-  const std::size_t text_size = text.size();
-  const std::vector<std::size_t> pref_func = prefixFunction(substr);
+TKmpMatcher::TKmpMatcher(std::string pattern)
+    : Pattern_(std::move(pattern)),
+      PrefFunc_(prefixFunction(Pattern_)) {
+  if (Pattern_.empty()) {
+    throw std::range_error("Pattern must not be empty");
+  }
+}
+
+[[nodiscard]] const std::string& TKmpMatcher::pattern() const noexcept {
+  return Pattern_;
+}
+
+[[nodiscard]] std::vector<std::size_t> TKmpMatcher::findAll(
+    std::string_view text) const {
+  const std::size_t pattern_size = Pattern_.size();
   std::vector<std::size_t> occurrences;
+  scan(text, 0, [&occurrences, pattern_size](std::size_t end) {
+    occurrences.push_back(end - pattern_size);
+  });
+  return occurrences;
+}
+
+[[nodiscard]] std::size_t TKmpMatcher::findFirst(
+    std::string_view text) const noexcept {
+  const std::size_t pattern_size = Pattern_.size();
+  const std::size_t text_size = text.size();
   std::size_t match_len = 0;
   for (std::size_t i = 0; i < text_size; ++i) {
-    while (match_len > 0 && text[i] != substr[match_len]) {
-      match_len = pref_func[match_len - 1];
-    }
-    if (text[i] == substr[match_len]) {
-      ++match_len;
-    }
-    if (match_len == substr_size) {
-      occurrences.push_back(i + 1 - substr_size);
-      match_len = pref_func[match_len - 1];
+    match_len = nextMatchLen(match_len, text[i]);
+    if (match_len == pattern_size) {
+      return i + 1 - pattern_size;
     }
   }
+  return std::string_view::npos;
+}
+
+[[nodiscard]] std::size_t TKmpMatcher::count(
+    std::string_view text) const noexcept {
+  std::size_t occurrences_count = 0;
+  scan(text, 0, [&occurrences_count](std::size_t) { ++occurrences_count; });
+  return occurrences_count;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TKmpStreamMatcher::TKmpStreamMatcher(std::string pattern)
+    : TKmpStreamMatcher(TKmpMatcher(std::move(pattern))) {
+}
+
+TKmpStreamMatcher::TKmpStreamMatcher(TKmpMatcher matcher)
+    : Matcher_(std::move(matcher)),
+      MatchLen_(0),
+      Offset_(0) {
+}
+
+[[nodiscard]] std::vector<std::uint64_t> TKmpStreamMatcher::feed(
+    std::string_view chunk) {
+  std::vector<std::uint64_t> occurrences;
+  feed(chunk,
+       [&occurrences](std::uint64_t offset) { occurrences.push_back(offset); });
   return occurrences;
 }
 
+[[nodiscard]] std::uint64_t TKmpStreamMatcher::offset() const noexcept {
+  return Offset_;
+}
+
+void TKmpStreamMatcher::reset() noexcept {
+  MatchLen_ = 0;
+  Offset_ = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+[[nodiscard]] std::vector<std::size_t> kmpSubstrSearch(
+    std::string_view text, std::string_view substr) {
+  return TKmpMatcher(std::string(substr)).findAll(text);
+}
+
+[[nodiscard]] std::vector<std::size_t> kmpSubstrSearch(
+    std::span<const std::byte> text, std::span<const std::byte> substr) {
+  return kmpSubstrSearch(NBytes::asStringView(text),
+                         NBytes::asStringView(substr));
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 }  // namespace NAds::NAlgo::NKmp
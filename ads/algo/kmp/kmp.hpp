@@ -1,15 +1,142 @@
 #pragma once
 
 #include <vector>
+#include <concepts>
+#include <span>
 #include <string>
+#include <string_view>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
 
 namespace NAds::NAlgo::NKmp {
 
 ////////////////////////////////////////////////////////////////////////////////
 
+// Pattern compiled once for any number of searches. All methods are const
+// and keep no state between calls, so one matcher may be shared by threads.
+class TKmpMatcher {
+public:
+  // Throws std::range_error for an empty pattern
+  explicit TKmpMatcher(std::string pattern);
+
+  [[nodiscard]] const std::string& pattern() const noexcept;
+
+  // Start positions of all occurrences, overlapping ones included
+  [[nodiscard]] std::vector<std::size_t> findAll(std::string_view text) const;
+
+  // Start position of the first occurrence, std::string_view::npos if none
+  [[nodiscard]] std::size_t findFirst(std::string_view text) const noexcept;
+
+  [[nodiscard]] std::size_t count(std::string_view text) const noexcept;
+
+  // Continues a search after a text whose longest suffix matching a pattern
+  // prefix has match_len chars. Calls callback(end) for every occurrence
+  // ending at text[end - 1] and returns match_len after the text, so a text
+  // may be scanned in pieces.
+  template <typename TCallback>
+  std::size_t scan(std::string_view text, std::size_t match_len,
+                   TCallback&& callback) const;
+
+private:
+  // match_len after c is appended to a text with match_len matched chars
+  [[nodiscard]] std::size_t nextMatchLen(std::size_t match_len,
+                                         char c) const noexcept;
+
+  std::string Pattern_;
+  std::vector<std::size_t> PrefFunc_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Pattern compiled into a full automaton with a row of 256 transitions per
+// matched length, so a search makes exactly one table lookup per byte
+// without the data-dependent fallback loop of TKmpMatcher. TState holds
+// matched lengths: std::uint8_t for patterns up to 255 chars keeps the table
+// of (|pattern| + 1) * 256 states within 64 KiB, and within a 32 KiB L1 cache
+// for patterns up to 127 chars, std::uint16_t serves patterns up to 65535
+// chars. Methods are const, one matcher may be shared by threads.
+template <std::unsigned_integral TState = std::uint16_t>
+class TKmpDfaMatcher {
+public:
+  static constexpr std::size_t MaxPatternSize =
+      std::numeric_limits<TState>::max();
+
+  // Throws std::range_error for an empty pattern or one longer than
+  // MaxPatternSize
+  explicit TKmpDfaMatcher(std::string pattern);
+
+  [[nodiscard]] const std::string& pattern() const noexcept;
+
+  // Start positions of all occurrences, overlapping ones included
+  [[nodiscard]] std::vector<std::size_t> findAll(std::string_view text) const;
+
+  // Start position of the first occurrence, std::string_view::npos if none
+  [[nodiscard]] std::size_t findFirst(std::string_view text) const noexcept;
+
+  [[nodiscard]] std::size_t count(std::string_view text) const noexcept;
+
+  // Same contract as TKmpMatcher::scan, the state is the matched length
+  template <typename TCallback>
+  TState scan(std::string_view text, TState state, TCallback&& callback) const;
+
+private:
+  static constexpr std::size_t AlphaSize = 256;
+
+  [[nodiscard]] static std::vector<TState> createTable(
+      const std::string& pattern);
+
+  std::string Pattern_;
+  // Row s holds the transitions of matched length s, including s = |pattern|
+  std::vector<TState> Table_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Searches a stream which arrives in chunks. Only the matched length and the
+// stream offset are kept between chunks, so memory is O(|pattern|)
+// regardless of the stream length, and occurrences crossing chunk
+// boundaries are found.
+class TKmpStreamMatcher {
+public:
+  // Throws std::range_error for an empty pattern
+  explicit TKmpStreamMatcher(std::string pattern);
+
+  explicit TKmpStreamMatcher(TKmpMatcher matcher);
+
+  // Calls callback(offset) with the stream offset of the start of every
+  // occurrence which ends in chunk
+  template <typename TCallback>
+  void feed(std::string_view chunk, TCallback&& callback);
+
+  // Stream offsets of occurrences which end in chunk
+  [[nodiscard]] std::vector<std::uint64_t> feed(std::string_view chunk);
+
+  // Number of chars fed so far
+  [[nodiscard]] std::uint64_t offset() const noexcept;
+
+  // Starts a new stream
+  void reset() noexcept;
+
+private:
+  TKmpMatcher Matcher_;
+  std::size_t MatchLen_;
+  std::uint64_t Offset_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+[[nodiscard]] std::vector<std::size_t> kmpSubstrSearch(
+    std::string_view text, std::string_view substr);
+
+// Raw bytes, e.g. of a memory mapped file, are searched without a copy
 [[nodiscard]] std::vector<std::size_t> kmpSubstrSearch(
-    const std::string& text, const std::string& substr);
+    std::span<const std::byte> text, std::span<const std::byte> substr);
 
 ////////////////////////////////////////////////////////////////////////////////
 
 }  // namespace NAds::NAlgo::NKmp
+
+#define ADS_ALGO_KMP_KMP_INL_HPP_
+#include "kmp-inl.hpp"
+#undef ADS_ALGO_KMP_KMP_INL_HPP_
@@ -0,0 +1,118 @@
+#include "mapped_file.hpp"
+#include "algo/bytes/bytes.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace NAds::NAlgo::NMappedFile {
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+
+[[noreturn]] void throwSystemError(const std::string& what,
+                                   const std::string& path) {
+  throw std::runtime_error(what + " " + path + ": " + std::strerror(errno));
+}
+
+// Closes the descriptor when the constructor leaves, the mapping stays valid
+class TFileDescriptor {
+public:
+  explicit TFileDescriptor(int fd) noexcept
+      : Fd_(fd) {
+  }
+
+  TFileDescriptor(const TFileDescriptor& other) = delete;
+
+  TFileDescriptor& operator=(const TFileDescriptor& other) = delete;
+
+  ~TFileDescriptor() {
+    if (Fd_ >= 0) {
+      ::close(Fd_);
+    }
+  }
+
+  [[nodiscard]] int get() const noexcept {
+    return Fd_;
+  }
+
+private:
+  int Fd_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+TMappedFile::TMappedFile(const std::string& path)
+    : Data_(nullptr),
+      Size_(0) {
+  const TFileDescriptor file(::open(path.c_str(), O_RDONLY | O_CLOEXEC));
+  if (file.get() < 0) {
+    throwSystemError("Cannot open", path);
+  }
+  struct stat file_stat {};
+  if (::fstat(file.get(), &file_stat) != 0) {
+    throwSystemError("Cannot stat", path);
+  }
+  Size_ = static_cast<std::size_t>(file_stat.st_size);
+  if (Size_ == 0) {
+    return;
+  }
+  void* data = ::mmap(nullptr, Size_, PROT_READ, MAP_PRIVATE, file.get(), 0);
+  if (data == MAP_FAILED) {
+    throwSystemError("Cannot map", path);
+  }
+  Data_ = data;
+  // Only a hint, the mapping works without it
+  ::madvise(Data_, Size_, MADV_SEQUENTIAL);
+}
+
+TMappedFile::TMappedFile(TMappedFile&& other) noexcept
+    : Data_(std::exchange(other.Data_, nullptr)),
+      Size_(std::exchange(other.Size_, 0)) {
+}
+
+TMappedFile& TMappedFile::operator=(TMappedFile&& other) noexcept {
+  TMappedFile moved(std::move(other));
+  swap(moved);
+  return *this;
+}
+
+TMappedFile::~TMappedFile() {
+  if (Data_ != nullptr) {
+    ::munmap(Data_, Size_);
+  }
+}
+
+[[nodiscard]] std::span<const std::byte> TMappedFile::bytes() const noexcept {
+  return {static_cast<const std::byte*>(Data_), Size_};
+}
+
+[[nodiscard]] std::string_view TMappedFile::view() const noexcept {
+  return NBytes::asStringView(bytes());
+}
+
+[[nodiscard]] std::size_t TMappedFile::size() const noexcept {
+  return Size_;
+}
+
+void TMappedFile::swap(TMappedFile& other) noexcept {
+  std::swap(Data_, other.Data_);
+  std::swap(Size_, other.Size_);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace NAds::NAlgo::NMappedFile
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <span>
+#include <string>
+#include <string_view>
+#include <cstddef>
+
+namespace NAds::NAlgo::NMappedFile {
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Read-only memory mapping of a whole file. Pages are read from the page
+// cache on demand, nothing is copied to the heap. The kernel is advised that
+// the mapping is read sequentially, so it reads ahead aggressively and drops
+// pages behind the reader early.
+class TMappedFile {
+public:
+  // Throws std::runtime_error if the file cannot be opened or mapped
+  explicit TMappedFile(const std::string& path);
+
+  TMappedFile(const TMappedFile& other) = delete;
+
+  TMappedFile& operator=(const TMappedFile& other) = delete;
+
+  TMappedFile(TMappedFile&& other) noexcept;
+
+  TMappedFile& operator=(TMappedFile&& other) noexcept;
+
+  ~TMappedFile();
+
+  [[nodiscard]] std::span<const std::byte> bytes() const noexcept;
+
+  // The same bytes as chars, e.g. for TKmpMatcher
+  [[nodiscard]] std::string_view view() const noexcept;
+
+  [[nodiscard]] std::size_t size() const noexcept;
+
+private:
+  void swap(TMappedFile& other) noexcept;
+
+  // nullptr for an empty file, which cannot be mapped
+  void* Data_;
+  std::size_t Size_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace NAds::NAlgo::NMappedFile
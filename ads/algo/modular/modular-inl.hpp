@@ -0,0 +1,156 @@
+#ifndef ADS_ALGO_MODULAR_MODULAR_INL_HPP_
+#error "Direct inclusion of this file is not allowed, include modular.hpp"
+// For the sake of sane code completion.
+#include "modular.hpp"
+#endif
+
+#include "algo/euclidean/euclidean.hpp"
+
+#include <stdexcept>
+
+namespace NAds::NAlgo::NModular {
+
+////////////////////////////////////////////////////////////////////////////////
+
+constexpr TMontgomery::TMontgomery(std::uint64_t modulus)
+    : N_(checkModulus(modulus)),
+      NInv_(inverse(modulus)),
+      R2_(static_cast<std::uint64_t>(-static_cast<TUint128>(modulus) %
+                                     modulus)),
+      One_((0 - modulus) % modulus) {
+}
+
+[[nodiscard]] constexpr std::uint64_t TMontgomery::modulus() const noexcept {
+  return N_;
+}
+
+[[nodiscard]] constexpr std::uint64_t TMontgomery::toMontgomery(
+    std::uint64_t x) const noexcept {
+  // x * R2_ < 2^64 * n, so no preliminary x % n is needed
+  return reduce(static_cast<TUint128>(x) * R2_);
+}
+
+[[nodiscard]] constexpr std::uint64_t TMontgomery::fromMontgomery(
+    std::uint64_t x) const noexcept {
+  return reduce(x);
+}
+
+[[nodiscard]] constexpr std::uint64_t TMontgomery::one() const noexcept {
+  return One_;
+}
+
+[[nodiscard]] constexpr std::uint64_t TMontgomery::add(
+    std::uint64_t a, std::uint64_t b) const noexcept {
+  return a >= N_ - b ? a - (N_ - b) : a + b;
+}
+
+[[nodiscard]] constexpr std::uint64_t TMontgomery::sub(
+    std::uint64_t a, std::uint64_t b) const noexcept {
+  return a >= b ? a - b : a - b + N_;
+}
+
+[[nodiscard]] constexpr std::uint64_t TMontgomery::mul(
+    std::uint64_t a, std::uint64_t b) const noexcept {
+  return reduce(static_cast<TUint128>(a) * b);
+}
+
+[[nodiscard]] constexpr std::uint64_t TMontgomery::pow(
+    std::uint64_t base, std::uint64_t exp) const noexcept {
+  std::uint64_t result = One_;
+  for (; exp != 0; exp >>= 1) {
+    if ((exp & 1) != 0) {
+      result = mul(result, base);
+    }
+    base = mul(base, base);
+  }
+  return result;
+}
+
+// (a * 2^64) * b * 2^(-64) = a * b, the first factor is reduced below n, so
+// the product fits into the precondition of reduce for any b
+[[nodiscard]] constexpr std::uint64_t TMontgomery::mulMod(
+    std::uint64_t a, std::uint64_t b) const noexcept {
+  return mul(toMontgomery(a), b);
+}
+
+[[nodiscard]] constexpr std::uint64_t TMontgomery::powMod(
+    std::uint64_t base, std::uint64_t exp) const noexcept {
+  return fromMontgomery(pow(toMontgomery(base), exp));
+}
+
+[[nodiscard]] constexpr std::uint64_t TMontgomery::checkModulus(
+    std::uint64_t modulus) {
+  if (modulus % 2 == 0 || modulus == 1) {
+    throw std::range_error("Modulus must be odd and greater than one");
+  }
+  return modulus;
+}
+
+[[nodiscard]] constexpr std::uint64_t TMontgomery::inverse(std::uint64_t n) {
+  std::uint64_t inv = n;
+  for (int i = 0; i < 5; ++i) {
+    inv *= 2 - n * inv;
+  }
+  return inv;
+}
+
+// Low words of t and m * n are equal, so the result is the difference of
+// high words
+[[nodiscard]] constexpr std::uint64_t TMontgomery::reduce(
+    TUint128 t) const noexcept {
+  const std::uint64_t m = static_cast<std::uint64_t>(t) * NInv_;
+  const auto mn_high =
+      static_cast<std::uint64_t>((static_cast<TUint128>(m) * N_) >> 64);
+  const auto t_high = static_cast<std::uint64_t>(t >> 64);
+  return t_high >= mn_high ? t_high - mn_high : t_high - mn_high + N_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+template <std::uint64_t Mod>
+constexpr TModInt<Mod>::TModInt(std::uint64_t value) noexcept
+    : Value_(Engine.toMontgomery(value)) {
+}
+
+template <std::uint64_t Mod>
+[[nodiscard]] constexpr std::uint64_t TModInt<Mod>::value() const noexcept {
+  return Engine.fromMontgomery(Value_);
+}
+
+template <std::uint64_t Mod>
+[[nodiscard]] constexpr TModInt<Mod> TModInt<Mod>::pow(
+    std::uint64_t exp) const noexcept {
+  TModInt result;
+  result.Value_ = Engine.pow(Value_, exp);
+  return result;
+}
+
+template <std::uint64_t Mod>
+[[nodiscard]] TModInt<Mod> TModInt<Mod>::inverse() const {
+  return TModInt(NEuclidean::modInverse(value(), Mod));
+}
+
+template <std::uint64_t Mod>
+constexpr TModInt<Mod>& TModInt<Mod>::operator+=(
+    const TModInt& other) noexcept {
+  Value_ = Engine.add(Value_, other.Value_);
+  return *this;
+}
+
+template <std::uint64_t Mod>
+constexpr TModInt<Mod>& TModInt<Mod>::operator-=(
+    const TModInt& other) noexcept {
+  Value_ = Engine.sub(Value_, other.Value_);
+  return *this;
+}
+
+template <std::uint64_t Mod>
+constexpr TModInt<Mod>& TModInt<Mod>::operator*=(
+    const TModInt& other) noexcept {
+  Value_ = Engine.mul(Value_, other.Value_);
+  return *this;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace NAds::NAlgo::NModular
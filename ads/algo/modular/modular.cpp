@@ -0,0 +1,69 @@
+#include "modular.hpp"
+
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+
+namespace NAds::NAlgo::NModular {
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Elements raised to a power together, their states fit into registers
+constexpr std::size_t PowBlockSize = 8;
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+void TMontgomery::mulMod(std::span<const std::uint64_t> a,
+                         std::span<const std::uint64_t> b,
+                         std::span<std::uint64_t> out) const {
+  if (a.size() != b.size() || a.size() != out.size()) {
+    throw std::range_error("Spans must have equal sizes");
+  }
+  const std::size_t size = a.size();
+  for (std::size_t i = 0; i < size; ++i) {
+    out[i] = mulMod(a[i], b[i]);
+  }
+}
+
+void TMontgomery::powMod(std::span<const std::uint64_t> bases,
+                         std::uint64_t exp,
+                         std::span<std::uint64_t> out) const {
+  if (bases.size() != out.size()) {
+    throw std::range_error("Spans must have equal sizes");
+  }
+  const std::size_t size = bases.size();
+  for (std::size_t begin = 0; begin < size; begin += PowBlockSize) {
+    const std::size_t block_size = std::min(PowBlockSize, size - begin);
+    std::array<std::uint64_t, PowBlockSize> powers{};
+    std::array<std::uint64_t, PowBlockSize> results{};
+    for (std::size_t j = 0; j < block_size; ++j) {
+      powers[j] = toMontgomery(bases[begin + j]);
+      results[j] = One_;
+    }
+    for (std::uint64_t rest = exp; rest != 0; rest >>= 1) {
+      if ((rest & 1) != 0) {
+        for (std::size_t j = 0; j < PowBlockSize; ++j) {
+          results[j] = mul(results[j], powers[j]);
+        }
+      }
+      for (std::size_t j = 0; j < PowBlockSize; ++j) {
+        powers[j] = mul(powers[j], powers[j]);
+      }
+    }
+    for (std::size_t j = 0; j < block_size; ++j) {
+      out[begin + j] = fromMontgomery(results[j]);
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace NAds::NAlgo::NModular
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <span>
+#include <cstdint>
+
+namespace NAds::NAlgo::NModular {
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Arithmetic modulo odd n > 1 on Montgomery representations x * 2^64 mod n.
+// Modulus constants are computed once by the constructor, after that neither
+// conversion nor multiplication needs a hardware division.
+class TMontgomery {
+public:
+  // Throws std::range_error if modulus is even or equal to 1
+  explicit constexpr TMontgomery(std::uint64_t modulus);
+
+  [[nodiscard]] constexpr std::uint64_t modulus() const noexcept;
+
+  // Any x < 2^64 is accepted, the result is in [0, modulus)
+  [[nodiscard]] constexpr std::uint64_t toMontgomery(
+      std::uint64_t x) const noexcept;
+
+  [[nodiscard]] constexpr std::uint64_t fromMontgomery(
+      std::uint64_t x) const noexcept;
+
+  // Montgomery representation of 1
+  [[nodiscard]] constexpr std::uint64_t one() const noexcept;
+
+  // Operands and results of add, sub, mul and pow are Montgomery
+  // representations in [0, modulus)
+  [[nodiscard]] constexpr std::uint64_t add(std::uint64_t a,
+                                            std::uint64_t b) const noexcept;
+
+  [[nodiscard]] constexpr std::uint64_t sub(std::uint64_t a,
+                                            std::uint64_t b) const noexcept;
+
+  [[nodiscard]] constexpr std::uint64_t mul(std::uint64_t a,
+                                            std::uint64_t b) const noexcept;
+
+  [[nodiscard]] constexpr std::uint64_t pow(std::uint64_t base,
+                                            std::uint64_t exp) const noexcept;
+
+  // a * b mod modulus of plain values, any a, b < 2^64
+  [[nodiscard]] constexpr std::uint64_t mulMod(std::uint64_t a,
+                                               std::uint64_t b) const noexcept;
+
+  // base^exp mod modulus of plain values
+  [[nodiscard]] constexpr std::uint64_t powMod(
+      std::uint64_t base, std::uint64_t exp) const noexcept;
+
+  // out[i] = a[i] * b[i] mod modulus of plain values. Throws
+  // std::range_error if sizes differ
+  void mulMod(std::span<const std::uint64_t> a,
+              std::span<const std::uint64_t> b,
+              std::span<std::uint64_t> out) const;
+
+  // out[i] = bases[i]^exp mod modulus of plain values. Elements of a block
+  // share the square-and-multiply schedule, so their multiplications are
+  // independent and overlap in the pipeline. Throws std::range_error if
+  // sizes differ
+  void powMod(std::span<const std::uint64_t> bases, std::uint64_t exp,
+              std::span<std::uint64_t> out) const;
+
+private:
+  __extension__ using TUint128 = unsigned __int128;
+
+  // Members after N_ are initialized from the checked modulus
+  [[nodiscard]] static constexpr std::uint64_t checkModulus(
+      std::uint64_t modulus);
+
+  // n^(-1) mod 2^64 by Newton's iteration, each step doubles correct bits
+  [[nodiscard]] static constexpr std::uint64_t inverse(std::uint64_t n);
+
+  // t * 2^(-64) mod n for t < n * 2^64
+  [[nodiscard]] constexpr std::uint64_t reduce(TUint128 t) const noexcept;
+
+  std::uint64_t N_;
+  std::uint64_t NInv_;
+  // 2^128 mod n
+  std::uint64_t R2_;
+  // 2^64 mod n
+  std::uint64_t One_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Residue modulo compile-time odd Mod > 1 stored in Montgomery form, so that
+// arithmetic needs no division
+template <std::uint64_t Mod>
+class TModInt {
+  static_assert(Mod % 2 == 1 && Mod > 1,
+                "Modulus must be odd and greater than one");
+
+public:
+  static constexpr TMontgomery Engine{Mod};
+
+  constexpr TModInt() noexcept = default;
+
+  explicit constexpr TModInt(std::uint64_t value) noexcept;
+
+  // Plain value in [0, Mod)
+  [[nodiscard]] constexpr std::uint64_t value() const noexcept;
+
+  [[nodiscard]] constexpr TModInt pow(std::uint64_t exp) const noexcept;
+
+  // Throws std::range_error if value is not coprime to Mod
+  [[nodiscard]] TModInt inverse() const;
+
+  constexpr TModInt& operator+=(const TModInt& other) noexcept;
+
+  constexpr TModInt& operator-=(const TModInt& other) noexcept;
+
+  constexpr TModInt& operator*=(const TModInt& other) noexcept;
+
+  [[nodiscard]] friend constexpr TModInt operator+(
+      TModInt lhs, const TModInt& rhs) noexcept {
+    return lhs += rhs;
+  }
+
+  [[nodiscard]] friend constexpr TModInt operator-(
+      TModInt lhs, const TModInt& rhs) noexcept {
+    return lhs -= rhs;
+  }
+
+  [[nodiscard]] friend constexpr TModInt operator*(
+      TModInt lhs, const TModInt& rhs) noexcept {
+    return lhs *= rhs;
+  }
+
+  [[nodiscard]] friend constexpr bool operator==(
+      const TModInt& lhs, const TModInt& rhs) noexcept = default;
+
+private:
+  // Montgomery representation
+  std::uint64_t Value_ = 0;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace NAds::NAlgo::NModular
+
+#define ADS_ALGO_MODULAR_MODULAR_INL_HPP_
+#include "modular-inl.hpp"
+#undef ADS_ALGO_MODULAR_MODULAR_INL_HPP_
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+#include <exception>
+#include <mutex>
+
+namespace NAds::NAlgo::NParallel {
+
+////////////////////////////////////////////////////////////////////////////////
+
+[[nodiscard]] inline std::size_t defaultThreadCount() noexcept {
+  return std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+}
+
+// Runs task(i) for every i in [0, tasks_count) on thread_count workers.
+// Tasks are handed out dynamically, so uneven tasks are balanced. The first
+// exception thrown by a task is rethrown in the calling thread.
+template <typename TTask>
+void parallelFor(const std::size_t& tasks_count,
+                 const std::size_t& thread_count, TTask&& task) {
+  const std::size_t workers_count =
+      std::min(std::max<std::size_t>(thread_count, 1), tasks_count);
+  if (workers_count <= 1) {
+    for (std::size_t i = 0; i < tasks_count; ++i) {
+      task(i);
+    }
+    return;
+  }
+  std::atomic<std::size_t> next_task = 0;
+  std::exception_ptr exception;
+  std::mutex exception_mutex;
+  auto worker = [&]() {
+    for (std::size_t i = next_task++; i < tasks_count; i = next_task++) {
+      try {
+        task(i);
+      } catch (...) {
+        const std::lock_guard<std::mutex> lock(exception_mutex);
+        if (exception == nullptr) {
+          exception = std::current_exception();
+        }
+        next_task = tasks_count;
+      }
+    }
+  };
+  {
+    std::vector<std::jthread> workers;
+    workers.reserve(workers_count - 1);
+    for (std::size_t i = 1; i < workers_count; ++i) {
+      workers.emplace_back(worker);
+    }
+    worker();
+  }
+  if (exception != nullptr) {
+    std::rethrow_exception(exception);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace NAds::NAlgo::NParallel
@@ -0,0 +1,181 @@
+#include "primality.hpp"
+#include "algo/euclidean/euclidean.hpp"
+#include "algo/modular/modular.hpp"
+#include "algo/sieve/sieve.hpp"
+#include "algo/sieve/linear_sieve.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <stdexcept>
+
+namespace NAds::NAlgo::NPrimality {
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Numbers up to this bound are handled by the smallest prime factor table
+constexpr std::uint32_t SmallLimit = 1U << 20;
+
+constexpr std::array<std::uint64_t, 15> SmallOddPrimes = {
+    3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53};
+
+// Miller-Rabin with these bases is deterministic for n < 2^64 (J. Sinclair)
+constexpr std::array<std::uint64_t, 7> MillerRabinBases = {
+    2, 325, 9375, 28178, 450775, 9780504, 1795265022};
+
+// Pollard's rho multiplies this many differences before taking one gcd
+constexpr std::uint64_t GcdBatchSize = 128;
+
+[[nodiscard]] const NSieve::TLinearSieve& smallSieve() {
+  static const NSieve::TLinearSieve sieve(SmallLimit);
+  return sieve;
+}
+
+// n is odd and greater than SmallLimit. Bases may exceed n, toMontgomery
+// reduces them modulo n, and a base divisible by n proves nothing, so it is
+// skipped
+[[nodiscard]] bool millerRabin(std::uint64_t n) {
+  const NModular::TMontgomery mont(n);
+  const int twos_count = std::countr_zero(n - 1);
+  const std::uint64_t odd_part = (n - 1) >> twos_count;
+  const std::uint64_t one = mont.one();
+  const std::uint64_t minus_one = n - one;
+  for (const std::uint64_t& base : MillerRabinBases) {
+    if (base % n == 0) {
+      continue;
+    }
+    std::uint64_t x = mont.pow(mont.toMontgomery(base), odd_part);
+    if (x == one || x == minus_one) {
+      continue;
+    }
+    bool is_composite = true;
+    for (int i = 1; i < twos_count && is_composite; ++i) {
+      x = mont.mul(x, x);
+      is_composite = (x != minus_one);
+    }
+    if (is_composite) {
+      return false;
+    }
+  }
+  return true;
+}
+
+[[nodiscard]] std::uint64_t absDiff(std::uint64_t a, std::uint64_t b) {
+  return a > b ? a - b : b - a;
+}
+
+// Nontrivial divisor of odd composite n. Brent's variant of Pollard's rho:
+// differences are multiplied in batches of GcdBatchSize and checked with one
+// gcd, after an overshoot the last batch is replayed step by step.
+[[nodiscard]] std::uint64_t pollardRho(std::uint64_t n) {
+  const NModular::TMontgomery mont(n);
+  for (std::uint64_t c = 1;; ++c) {
+    const std::uint64_t c_mont = mont.toMontgomery(c);
+    auto next = [&mont, c_mont](std::uint64_t y) {
+      return mont.add(mont.mul(y, y), c_mont);
+    };
+    std::uint64_t y = mont.toMontgomery(2);
+    std::uint64_t x = y;
+    std::uint64_t saved_y = y;
+    std::uint64_t product = mont.one();
+    std::uint64_t divisor = 1;
+    for (std::uint64_t r = 1; divisor == 1; r *= 2) {
+      x = y;
+      for (std::uint64_t i = 0; i < r; ++i) {
+        y = next(y);
+      }
+      for (std::uint64_t k = 0; k < r && divisor == 1; k += GcdBatchSize) {
+        saved_y = y;
+        const std::uint64_t batch_size = std::min(GcdBatchSize, r - k);
+        for (std::uint64_t i = 0; i < batch_size; ++i) {
+          y = next(y);
+          product = mont.mul(product, absDiff(x, y));
+        }
+        divisor = NEuclidean::gcd(product, n);
+      }
+    }
+    if (divisor == n) {
+      do {
+        saved_y = next(saved_y);
+        divisor = NEuclidean::gcd(absDiff(x, saved_y), n);
+      } while (divisor == 1);
+    }
+    if (divisor != n) {
+      return divisor;
+    }
+  }
+}
+
+// n is odd and has no prime factors from SmallOddPrimes
+void factorize(std::uint64_t n, std::vector<std::uint64_t>& factors) {
+  if (n <= SmallLimit) {
+    const NSieve::TLinearSieve& sieve = smallSieve();
+    auto value = static_cast<std::uint32_t>(n);
+    while (value > 1) {
+      const std::uint32_t prime = sieve.smallestPrimeFactor(value);
+      factors.push_back(prime);
+      value /= prime;
+    }
+    return;
+  }
+  if (millerRabin(n)) {
+    factors.push_back(n);
+    return;
+  }
+  const std::uint64_t divisor = pollardRho(n);
+  factorize(divisor, factors);
+  factorize(n / divisor, factors);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+[[nodiscard]] bool isPrime(std::uint64_t n) {
+  if (n <= NSieve::ConstexprSieveLimit) {
+    return NSieve::isSmallPrime(n);
+  }
+  if (n <= SmallLimit) {
+    return smallSieve().isPrime(static_cast<std::uint32_t>(n));
+  }
+  if (n % 2 == 0) {
+    return false;
+  }
+  for (const std::uint64_t& prime : SmallOddPrimes) {
+    if (n % prime == 0) {
+      return false;
+    }
+  }
+  return millerRabin(n);
+}
+
+[[nodiscard]] std::vector<std::uint64_t> factor(std::uint64_t n) {
+  if (n == 0) {
+    throw std::range_error("Zero has no factorization");
+  }
+  std::vector<std::uint64_t> factors;
+  const int twos_count = std::countr_zero(n);
+  factors.insert(factors.end(), static_cast<std::size_t>(twos_count), 2);
+  n >>= twos_count;
+  for (const std::uint64_t& prime : SmallOddPrimes) {
+    while (n % prime == 0) {
+      factors.push_back(prime);
+      n /= prime;
+    }
+  }
+  if (n > 1) {
+    factorize(n, factors);
+  }
+  std::sort(factors.begin(), factors.end());
+  return factors;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace NAds::NAlgo::NPrimality
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+namespace NAds::NAlgo::NPrimality {
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Deterministic Miller-Rabin test for the whole uint64 range. Small numbers
+// are looked up in a sieve table.
+[[nodiscard]] bool isPrime(std::uint64_t n);
+
+// Prime factors of n in non-decreasing order with multiplicity. Small
+// cofactors are factorized by a smallest prime factor table, large ones by
+// Pollard's rho with Brent's cycle detection.
+[[nodiscard]] std::vector<std::uint64_t> factor(std::uint64_t n);
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace NAds::NAlgo::NPrimality
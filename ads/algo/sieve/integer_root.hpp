@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstdint>
+#include <cmath>
+
+namespace NAds::NAlgo::NSieve {
+
+////////////////////////////////////////////////////////////////////////////////
+
+// floor(sqrt(n)) without floating point rounding errors
+[[nodiscard]] inline std::uint64_t integerSqrt(const std::uint64_t& n) {
+  auto root = static_cast<std::uint64_t>(std::sqrt(static_cast<double>(n)));
+  while (root > 0 && root > n / root) {
+    --root;
+  }
+  while (root + 1 <= n / (root + 1)) {
+    ++root;
+  }
+  return root;
+}
+
+// floor(cbrt(n)) without floating point rounding errors
+[[nodiscard]] inline std::uint64_t integerCbrt(const std::uint64_t& n) {
+  auto root = static_cast<std::uint64_t>(std::cbrt(static_cast<double>(n)));
+  while (root > 0 && root > n / root / root) {
+    --root;
+  }
+  while (root + 1 <= n / (root + 1) / (root + 1)) {
+    ++root;
+  }
+  return root;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace NAds::NAlgo::NSieve
@@ -0,0 +1,114 @@
+#include "linear_sieve.hpp"
+
+#include <stdexcept>
+#include <bit>
+
+namespace NAds::NAlgo::NSieve {
+
+////////////////////////////////////////////////////////////////////////////////
+
+TLinearSieve::TLinearSieve(const std::uint32_t& n)
+    : N_(n),
+      OddFactors_(n / 2 + 1, 0) {
+  if (n == 0U) {
+    throw std::range_error("Argument must be greater than zero");
+  }
+  // Every odd composite c is marked once as c = i * p where p is its
+  // smallest prime factor, p <= smallest prime factor of i, so p <= sqrt(n)
+  std::vector<std::uint32_t> odd_primes;
+  const std::uint64_t limit = n;
+  for (std::uint64_t i = 3; i * 3 <= limit; i += 2) {
+    const std::uint16_t factor = OddFactors_[i / 2];
+    if (factor == 0 && i * i <= limit) {
+      odd_primes.push_back(static_cast<std::uint32_t>(i));
+    }
+    const std::uint64_t max_prime = (factor == 0 ? i : factor);
+    for (const std::uint32_t& prime : odd_primes) {
+      if (prime > max_prime || i * prime > limit) {
+        break;
+      }
+      OddFactors_[i * prime / 2] = static_cast<std::uint16_t>(prime);
+    }
+  }
+}
+
+[[nodiscard]] std::uint32_t TLinearSieve::limit() const noexcept {
+  return N_;
+}
+
+[[nodiscard]] bool TLinearSieve::isPrime(const std::uint32_t& x) const {
+  if (x > N_) {
+    throw std::out_of_range("Number exceeds the sieve limit");
+  }
+  if (x % 2 == 0) {
+    return x == 2;
+  }
+  return x != 1 && OddFactors_[x / 2] == 0;
+}
+
+[[nodiscard]] std::uint32_t TLinearSieve::smallestPrimeFactor(
+    const std::uint32_t& x) const {
+  if (x > N_) {
+    throw std::out_of_range("Number exceeds the sieve limit");
+  }
+  if (x < 2) {
+    throw std::range_error("Number must be greater than one");
+  }
+  return x % 2 == 0 ? 2 : oddSmallestPrimeFactor(x);
+}
+
+[[nodiscard]] std::vector<std::uint32_t> TLinearSieve::factorize(
+    const std::uint32_t& x) const {
+  std::vector<std::uint32_t> factors;
+  factorize(x, factors);
+  return factors;
+}
+
+std::size_t TLinearSieve::factorize(const std::uint32_t& x,
+                                    std::vector<std::uint32_t>& factors) const {
+  if (x > N_) {
+    throw std::out_of_range("Number exceeds the sieve limit");
+  }
+  if (x == 0) {
+    throw std::range_error("Zero has no factorization");
+  }
+  const std::size_t factors_count = factors.size();
+  const int twos_count = std::countr_zero(x);
+  factors.insert(factors.end(), static_cast<std::size_t>(twos_count), 2U);
+  std::uint32_t value = x >> twos_count;
+  while (value > 1) {
+    const std::uint32_t prime = oddSmallestPrimeFactor(value);
+    factors.push_back(prime);
+    value /= prime;
+  }
+  return factors.size() - factors_count;
+}
+
+[[nodiscard]] TLinearSieve::TBatchFactorization TLinearSieve::factorizeBatch(
+    std::span<const std::uint32_t> values) const {
+  // Numbers below 10^8 have about 4 prime factors on average
+  constexpr std::size_t ExpectedFactorsCount = 4;
+  TBatchFactorization result;
+  result.Offsets.reserve(values.size() + 1);
+  result.Factors.reserve(values.size() * ExpectedFactorsCount);
+  result.Offsets.push_back(0);
+  for (const std::uint32_t& value : values) {
+    factorize(value, result.Factors);
+    result.Offsets.push_back(result.Factors.size());
+  }
+  return result;
+}
+
+[[nodiscard]] std::size_t TLinearSieve::memoryUsage() const noexcept {
+  return OddFactors_.size() * sizeof(std::uint16_t);
+}
+
+[[nodiscard]] std::uint32_t TLinearSieve::oddSmallestPrimeFactor(
+    const std::uint32_t& x) const noexcept {
+  const std::uint16_t factor = OddFactors_[x / 2];
+  return factor == 0 ? x : factor;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace NAds::NAlgo::NSieve
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <vector>
+#include <span>
+#include <cstdint>
+
+namespace NAds::NAlgo::NSieve {
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Linear (Euler) sieve over [0, n] which keeps the smallest prime factor of
+// every odd composite number. Factors of composites do not exceed
+// sqrt(n) < 2^16, so the table takes 2 bytes per odd number, 0 marks primes.
+class TLinearSieve {
+public:
+  // Prime factors of values[i] are Factors[Offsets[i], Offsets[i + 1])
+  struct TBatchFactorization {
+    std::vector<std::uint32_t> Factors;
+    std::vector<std::size_t> Offsets;
+  };
+
+  explicit TLinearSieve(const std::uint32_t& n);
+
+  [[nodiscard]] std::uint32_t limit() const noexcept;
+
+  [[nodiscard]] bool isPrime(const std::uint32_t& x) const;
+
+  // x must be in [2, n]
+  [[nodiscard]] std::uint32_t smallestPrimeFactor(const std::uint32_t& x) const;
+
+  // Prime factors of x in non-decreasing order with multiplicity
+  [[nodiscard]] std::vector<std::uint32_t> factorize(
+      const std::uint32_t& x) const;
+
+  // Appends prime factors of x to factors, returns their number
+  std::size_t factorize(const std::uint32_t& x,
+                        std::vector<std::uint32_t>& factors) const;
+
+  [[nodiscard]] TBatchFactorization factorizeBatch(
+      std::span<const std::uint32_t> values) const;
+
+  // Size of the factor table in bytes
+  [[nodiscard]] std::size_t memoryUsage() const noexcept;
+
+private:
+  // Factor table stores odd numbers only: index i corresponds to 2i + 1
+  [[nodiscard]] std::uint32_t oddSmallestPrimeFactor(
+      const std::uint32_t& x) const noexcept;
+
+  std::uint32_t N_;
+  std::vector<std::uint16_t> OddFactors_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace NAds::NAlgo::NSieve
@@ -0,0 +1,256 @@
+#include "multiplicative_sieve.hpp"
+#include "sieve.hpp"
+#include "integer_root.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace NAds::NAlgo::NSieve {
+
+////////////////////////////////////////////////////////////////////////////////
+
+[[nodiscard]] TMultiplicativeTables createMultiplicativeTables(
+    const std::uint32_t& n, const TMultiplicativeFunctions& functions) {
+  const std::size_t size = static_cast<std::size_t>(n) + 1;
+  TMultiplicativeTables tables;
+  if (functions.Phi) {
+    tables.Phi.assign(size, 0);
+  }
+  if (functions.Mu) {
+    tables.Mu.assign(size, 0);
+  }
+  if (functions.DivisorCount) {
+    tables.DivisorCount.assign(size, 0);
+  }
+  if (functions.DivisorSum) {
+    tables.DivisorSum.assign(size, 0);
+  }
+  if (n == 0U) {
+    return tables;
+  }
+  std::vector<std::uint32_t>& phi = tables.Phi;
+  std::vector<std::int8_t>& mu = tables.Mu;
+  std::vector<std::uint16_t>& count = tables.DivisorCount;
+  std::vector<std::uint64_t>& sum = tables.DivisorSum;
+  // cofactors[i] is i without the powers of its smallest prime factor
+  const bool needs_cofactors = functions.DivisorCount || functions.DivisorSum;
+  std::vector<std::uint32_t> cofactors(needs_cofactors ? size : 0);
+  std::vector<bool> is_composite(size, false);
+  std::vector<std::uint32_t> primes;
+  if (functions.Phi) {
+    phi[1] = 1;
+  }
+  if (functions.Mu) {
+    mu[1] = 1;
+  }
+  if (functions.DivisorCount) {
+    count[1] = 1;
+  }
+  if (functions.DivisorSum) {
+    sum[1] = 1;
+  }
+  if (needs_cofactors) {
+    cofactors[1] = 1;
+  }
+  const std::uint64_t limit = n;
+  for (std::uint64_t i = 2; i <= limit; ++i) {
+    if (!is_composite[i]) {
+      // Primes greater than n / 2 have no multiples to mark
+      if (2 * i <= limit) {
+        primes.push_back(static_cast<std::uint32_t>(i));
+      }
+      if (functions.Phi) {
+        phi[i] = static_cast<std::uint32_t>(i - 1);
+      }
+      if (functions.Mu) {
+        mu[i] = -1;
+      }
+      if (functions.DivisorCount) {
+        count[i] = 2;
+      }
+      if (functions.DivisorSum) {
+        sum[i] = i + 1;
+      }
+      if (needs_cofactors) {
+        cofactors[i] = 1;
+      }
+    }
+    for (const std::uint32_t& prime : primes) {
+      const std::uint64_t multiple = i * prime;
+      if (multiple > limit) {
+        break;
+      }
+      is_composite[multiple] = true;
+      if (i % prime == 0) {
+        // prime is the smallest prime factor of i
+        if (functions.Phi) {
+          phi[multiple] = phi[i] * prime;
+        }
+        if (functions.Mu) {
+          mu[multiple] = 0;
+        }
+        if (needs_cofactors) {
+          const std::uint32_t cofactor = cofactors[i];
+          cofactors[multiple] = cofactor;
+          if (functions.DivisorCount) {
+            count[multiple] =
+                static_cast<std::uint16_t>(count[i] + count[cofactor]);
+          }
+          if (functions.DivisorSum) {
+            sum[multiple] = sum[cofactor] + prime * sum[i];
+          }
+        }
+        break;
+      }
+      // prime is less than the smallest prime factor of i, so coprime to i
+      if (functions.Phi) {
+        phi[multiple] = phi[i] * (prime - 1);
+      }
+      if (functions.Mu) {
+        mu[multiple] = static_cast<std::int8_t>(-mu[i]);
+      }
+      if (functions.DivisorCount) {
+        count[multiple] = static_cast<std::uint16_t>(2 * count[i]);
+      }
+      if (functions.DivisorSum) {
+        sum[multiple] = sum[i] * (prime + 1);
+      }
+      if (needs_cofactors) {
+        cofactors[multiple] = static_cast<std::uint32_t>(i);
+      }
+    }
+  }
+  return tables;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TSegmentedMultiplicativeSieve::TSegmentedMultiplicativeSieve(
+    const std::uint32_t& n, const TMultiplicativeFunctions& functions,
+    const std::size_t& segment_size)
+    : N_(n),
+      Functions_(functions),
+      SegmentSize_(segment_size),
+      NextLow_(0) {
+  if (segment_size == 0ULL) {
+    throw std::range_error("Segment size must be greater than zero");
+  }
+  const std::uint64_t sqrt_n = integerSqrt(n);
+  if (sqrt_n >= 2) {
+    const std::vector<bool> is_prime = createEratoSieve(sqrt_n);
+    for (std::uint64_t i = 2; i <= sqrt_n; ++i) {
+      if (is_prime[i]) {
+        BasePrimes_.push_back(static_cast<std::uint32_t>(i));
+      }
+    }
+  }
+}
+
+[[nodiscard]] bool TSegmentedMultiplicativeSieve::nextSegment() {
+  if (NextLow_ > N_) {
+    resetSegment(0);
+    return false;
+  }
+  const std::uint64_t low = NextLow_;
+  const std::uint64_t high =
+      std::min<std::uint64_t>(N_, low + SegmentSize_ - 1);
+  const std::size_t size = high - low + 1;
+  NextLow_ = high + 1;
+  resetSegment(size);
+  Tables_.Low = low;
+  for (std::size_t i = 0; i < size; ++i) {
+    Cofactors_[i] = static_cast<std::uint32_t>(low + i);
+  }
+  for (const std::uint32_t& base_prime : BasePrimes_) {
+    const std::uint64_t prime = base_prime;
+    if (prime * prime > high) {
+      break;
+    }
+    std::size_t offset = (prime - low % prime) % prime;
+    // 0 is divisible by every prime, its values are reset below
+    if (low + offset == 0) {
+      offset += prime;
+    }
+    for (; offset < size; offset += prime) {
+      std::uint32_t cofactor = Cofactors_[offset];
+      std::uint64_t exponent = 0;
+      std::uint64_t prime_power = 1;
+      while (cofactor % prime == 0) {
+        cofactor /= base_prime;
+        ++exponent;
+        prime_power *= prime;
+      }
+      Cofactors_[offset] = cofactor;
+      applyPrimePower(offset, prime, exponent, prime_power);
+    }
+  }
+  // A cofactor greater than one is a prime greater than sqrt(high)
+  for (std::size_t offset = 0; offset < size; ++offset) {
+    const std::uint64_t cofactor = Cofactors_[offset];
+    if (cofactor > 1) {
+      applyPrimePower(offset, cofactor, 1, cofactor);
+    }
+  }
+  if (low == 0) {
+    if (Functions_.Phi) {
+      Tables_.Phi[0] = 0;
+    }
+    if (Functions_.Mu) {
+      Tables_.Mu[0] = 0;
+    }
+    if (Functions_.DivisorCount) {
+      Tables_.DivisorCount[0] = 0;
+    }
+    if (Functions_.DivisorSum) {
+      Tables_.DivisorSum[0] = 0;
+    }
+  }
+  return true;
+}
+
+[[nodiscard]] const TMultiplicativeTables&
+TSegmentedMultiplicativeSieve::segment() const noexcept {
+  return Tables_;
+}
+
+void TSegmentedMultiplicativeSieve::resetSegment(const std::size_t& size) {
+  Cofactors_.resize(size);
+  if (Functions_.Phi) {
+    Tables_.Phi.assign(size, 1);
+  }
+  if (Functions_.Mu) {
+    Tables_.Mu.assign(size, 1);
+  }
+  if (Functions_.DivisorCount) {
+    Tables_.DivisorCount.assign(size, 1);
+  }
+  if (Functions_.DivisorSum) {
+    Tables_.DivisorSum.assign(size, 1);
+  }
+}
+
+void TSegmentedMultiplicativeSieve::applyPrimePower(
+    const std::size_t& offset, const std::uint64_t& prime,
+    const std::uint64_t& exponent, const std::uint64_t& prime_power) {
+  if (Functions_.Phi) {
+    Tables_.Phi[offset] *=
+        static_cast<std::uint32_t>(prime_power / prime * (prime - 1));
+  }
+  if (Functions_.Mu) {
+    Tables_.Mu[offset] =
+        static_cast<std::int8_t>(exponent == 1 ? -Tables_.Mu[offset] : 0);
+  }
+  if (Functions_.DivisorCount) {
+    Tables_.DivisorCount[offset] = static_cast<std::uint16_t>(
+        Tables_.DivisorCount[offset] * (exponent + 1));
+  }
+  if (Functions_.DivisorSum) {
+    // prime^2 overflows only for exponent 1, where sigma = prime + 1
+    Tables_.DivisorSum[offset] *=
+        exponent == 1 ? prime + 1 : (prime_power * prime - 1) / (prime - 1);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace NAds::NAlgo::NSieve
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+
+namespace NAds::NAlgo::NSieve {
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Multiplicative functions to tabulate, tables of the others stay empty
+struct TMultiplicativeFunctions {
+  bool Phi = true;
+  bool Mu = true;
+  bool DivisorCount = true;
+  bool DivisorSum = true;
+};
+
+// Values of Euler's totient, Moebius function, number and sum of divisors
+// for consecutive integers: entry i corresponds to Low + i. All functions
+// are 0 at 0. For arguments below 2^32 the types are exact: d(x) <= 1344,
+// sigma(x) needs 64 bits.
+struct TMultiplicativeTables {
+  std::uint64_t Low = 0;
+  std::vector<std::uint32_t> Phi;
+  std::vector<std::int8_t> Mu;
+  std::vector<std::uint16_t> DivisorCount;
+  std::vector<std::uint64_t> DivisorSum;
+};
+
+// Linear sieve over [0, n] which fills all selected tables in one pass.
+// Every composite i * p, p = lpf(i * p), is computed from i and from the part
+// m of i coprime to p:
+//   phi(i * p) = phi(i) * p,  d(i * p) = d(i) + d(m),
+//   sigma(i * p) = sigma(m) + p * sigma(i)  if p divides i,
+// and by multiplicativity otherwise.
+// Time: O(n), additional memory: O(n) for m when d or sigma is selected
+[[nodiscard]] TMultiplicativeTables createMultiplicativeTables(
+    const std::uint32_t& n, const TMultiplicativeFunctions& functions = {});
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Streams the tables of [0, n] segment by segment. Numbers of a segment are
+// divided by every prime up to sqrt(n), the remaining cofactor is either 1
+// or a prime. Peak memory is O(sqrt(n) + segment_size).
+class TSegmentedMultiplicativeSieve {
+public:
+  // About 1 MiB of tables and cofactors when all functions are selected
+  static constexpr std::size_t DefaultSegmentSize = 1ULL << 16;
+
+  explicit TSegmentedMultiplicativeSieve(
+      const std::uint32_t& n, const TMultiplicativeFunctions& functions = {},
+      const std::size_t& segment_size = DefaultSegmentSize);
+
+  // Computes next segment. Returns false when the range is exhausted
+  [[nodiscard]] bool nextSegment();
+
+  // Tables of the current segment
+  [[nodiscard]] const TMultiplicativeTables& segment() const noexcept;
+
+private:
+  void resetSegment(const std::size_t& size);
+
+  // Multiplies values at offset by f(prime^exponent)
+  void applyPrimePower(const std::size_t& offset, const std::uint64_t& prime,
+                       const std::uint64_t& exponent,
+                       const std::uint64_t& prime_power);
+
+  std::uint64_t N_;
+  TMultiplicativeFunctions Functions_;
+  std::size_t SegmentSize_;
+  std::uint64_t NextLow_;
+  // Primes up to sqrt(n)
+  std::vector<std::uint32_t> BasePrimes_;
+  std::vector<std::uint32_t> Cofactors_;
+  TMultiplicativeTables Tables_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace NAds::NAlgo::NSieve
@@ -0,0 +1,111 @@
+#include "parallel_sieve.hpp"
+
+#include <algorithm>
+#include <bit>
+
+namespace NAds::NAlgo::NSieve {
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Each chunk is at least MinChunkSegments segments long, so that the
+// per-chunk setup (one division per base prime) is negligible, and there are
+// about ChunksPerThread chunks per thread to balance the load
+constexpr std::uint64_t MinChunkSegments = 8;
+constexpr std::uint64_t ChunksPerThread = 8;
+
+struct TChunks {
+  std::uint64_t ChunkSize;
+  std::size_t ChunksCount;
+};
+
+[[nodiscard]] TChunks splitIntoChunks(const std::uint64_t& n,
+                                      const std::size_t& thread_count,
+                                      const std::size_t& segment_size) {
+  const std::uint64_t aligned_segment_size = (segment_size + 63) / 64 * 64;
+  const std::uint64_t min_chunk_size = MinChunkSegments * aligned_segment_size;
+  const std::uint64_t balanced_chunk_size =
+      n / (std::max<std::uint64_t>(thread_count, 1) * ChunksPerThread);
+  std::uint64_t chunk_size = std::max(min_chunk_size, balanced_chunk_size);
+  chunk_size = (chunk_size + aligned_segment_size - 1) / aligned_segment_size *
+               aligned_segment_size;
+  return TChunks{.ChunkSize = chunk_size,
+                 .ChunksCount = static_cast<std::size_t>(n / chunk_size + 1)};
+}
+
+// Calls task(chunk_ind, sieve) for every chunk of [0, n] in parallel
+template <typename TTask>
+void sieveChunks(const std::uint64_t& n, const std::size_t& thread_count,
+                 const std::size_t& segment_size, const TChunks& chunks,
+                 TTask&& task) {
+  const std::vector<std::uint32_t> base_primes = createBasePrimes(n);
+  NParallel::parallelFor(
+      chunks.ChunksCount, thread_count, [&](const std::size_t& chunk_ind) {
+        const std::uint64_t low = chunk_ind * chunks.ChunkSize;
+        const std::uint64_t high = std::min(n, low + chunks.ChunkSize - 1);
+        TSegmentedSieve sieve(base_primes, low, high, segment_size);
+        task(chunk_ind, sieve);
+      });
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+[[nodiscard]] std::uint64_t parallelCountPrimes(
+    const std::uint64_t& n, const std::size_t& thread_count,
+    const std::size_t& segment_size) {
+  const TChunks chunks = splitIntoChunks(n, thread_count, segment_size);
+  std::vector<std::uint64_t> chunk_counts(chunks.ChunksCount, 0);
+  sieveChunks(n, thread_count, segment_size, chunks,
+              [&chunk_counts](const std::size_t& chunk_ind,
+                              TSegmentedSieve& sieve) {
+                std::uint64_t count = 0;
+                while (sieve.nextSegment()) {
+                  for (const std::uint64_t& word : sieve.segmentBitmap()) {
+                    count += static_cast<std::uint64_t>(std::popcount(word));
+                  }
+                }
+                chunk_counts[chunk_ind] = count;
+              });
+  std::uint64_t count = 0;
+  for (const std::uint64_t& chunk_count : chunk_counts) {
+    count += chunk_count;
+  }
+  return count;
+}
+
+[[nodiscard]] std::vector<std::uint64_t> parallelSievePrimes(
+    const std::uint64_t& n, const std::size_t& thread_count,
+    const std::size_t& segment_size) {
+  const TChunks chunks = splitIntoChunks(n, thread_count, segment_size);
+  std::vector<std::vector<std::uint64_t>> chunk_primes(chunks.ChunksCount);
+  sieveChunks(n, thread_count, segment_size, chunks,
+              [&chunk_primes](const std::size_t& chunk_ind,
+                              TSegmentedSieve& sieve) {
+                std::vector<std::uint64_t>& primes = chunk_primes[chunk_ind];
+                sieve.forEachPrime([&primes](const std::uint64_t& prime) {
+                  primes.push_back(prime);
+                });
+              });
+  std::size_t primes_count = 0;
+  for (const std::vector<std::uint64_t>& primes : chunk_primes) {
+    primes_count += primes.size();
+  }
+  std::vector<std::uint64_t> primes;
+  primes.reserve(primes_count);
+  for (std::vector<std::uint64_t>& chunk : chunk_primes) {
+    primes.insert(primes.end(), chunk.begin(), chunk.end());
+    std::vector<std::uint64_t>().swap(chunk);
+  }
+  return primes;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace NAds::NAlgo::NSieve
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "segmented_sieve.hpp"
+#include "algo/parallel/parallel_for.hpp"
+
+namespace NAds::NAlgo::NSieve {
+
+////////////////////////////////////////////////////////////////////////////////
+
+// [0, n] is split into independent chunks which are sieved by
+// TSegmentedSieve on thread_count threads with shared base primes. Results of
+// the chunks are merged in increasing order.
+
+[[nodiscard]] std::uint64_t parallelCountPrimes(
+    const std::uint64_t& n,
+    const std::size_t& thread_count = NParallel::defaultThreadCount(),
+    const std::size_t& segment_size = TSegmentedSieve::DefaultSegmentSize);
+
+[[nodiscard]] std::vector<std::uint64_t> parallelSievePrimes(
+    const std::uint64_t& n,
+    const std::size_t& thread_count = NParallel::defaultThreadCount(),
+    const std::size_t& segment_size = TSegmentedSieve::DefaultSegmentSize);
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace NAds::NAlgo::NSieve
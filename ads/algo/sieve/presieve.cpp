@@ -0,0 +1,147 @@
+#include "presieve.hpp"
+
+#include <algorithm>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define ADS_ALGO_SIEVE_PRESIEVE_AVX2
+#endif
+
+namespace NAds::NAlgo::NSieve {
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Bits of odd numbers for a word starting at an even number
+constexpr std::uint64_t OddBitsMask = 0xAAAAAAAAAAAAAAAAULL;
+
+// Since 64 is invertible modulo an odd modulus m, a word of the pattern of
+// primes with product m depends only on the word index modulo m. Primes are
+// split into two groups to keep both patterns small: 1155 + 221 words.
+constexpr std::uint64_t ModulusA = 3 * 5 * 7 * 11;
+constexpr std::uint64_t ModulusB = 13 * 17;
+
+// Bit j of word k is set iff 64 * k + j is a multiple of one of primes
+template <std::uint64_t Modulus, std::size_t PrimesCount>
+[[nodiscard]] constexpr std::array<std::uint64_t, Modulus> createPattern(
+    const std::array<std::uint64_t, PrimesCount>& primes) {
+  std::array<std::uint64_t, Modulus> words{};
+  for (std::uint64_t k = 0; k < Modulus; ++k) {
+    for (std::uint64_t j = 0; j < 64; ++j) {
+      for (const std::uint64_t& prime : primes) {
+        if ((64 * k + j) % prime == 0) {
+          words[k] |= 1ULL << j;
+        }
+      }
+    }
+  }
+  return words;
+}
+
+// 64^(-1) modulo odd modulus
+[[nodiscard]] constexpr std::uint64_t inverseOf64(
+    const std::uint64_t& modulus) {
+  std::uint64_t inverse = 1;
+  while (64 * inverse % modulus != 1) {
+    ++inverse;
+  }
+  return inverse;
+}
+
+constexpr std::array<std::uint64_t, ModulusA> PatternA =
+    createPattern<ModulusA>(std::array<std::uint64_t, 4>{3, 5, 7, 11});
+constexpr std::array<std::uint64_t, ModulusB> PatternB =
+    createPattern<ModulusB>(std::array<std::uint64_t, 2>{13, 17});
+constexpr std::uint64_t InverseA = inverseOf64(ModulusA);
+constexpr std::uint64_t InverseB = inverseOf64(ModulusB);
+
+// out[i] = odd_mask & ~(a[i] | b[i])
+void combineScalar(const std::uint64_t* a, const std::uint64_t* b,
+                   const std::uint64_t& odd_mask, std::uint64_t* out,
+                   const std::size_t& count) {
+  for (std::size_t i = 0; i < count; ++i) {
+    out[i] = odd_mask & ~(a[i] | b[i]);
+  }
+}
+
+#ifdef ADS_ALGO_SIEVE_PRESIEVE_AVX2
+__attribute__((target("avx2"))) void combineAvx2(
+    const std::uint64_t* a, const std::uint64_t* b,
+    const std::uint64_t& odd_mask, std::uint64_t* out,
+    const std::size_t& count) {
+  const __m256i odd = _mm256_set1_epi64x(static_cast<long long>(odd_mask));
+  std::size_t i = 0;
+  for (; i + 4 <= count; i += 4) {
+    const __m256i multiples = _mm256_or_si256(
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i)),
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i)));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i),
+                        _mm256_andnot_si256(multiples, odd));
+  }
+  combineScalar(a + i, b + i, odd_mask, out + i, count - i);
+}
+#endif
+
+using TCombine = void (*)(const std::uint64_t*, const std::uint64_t*,
+                          const std::uint64_t&, std::uint64_t*,
+                          const std::size_t&);
+
+[[nodiscard]] TCombine selectCombine() {
+#ifdef ADS_ALGO_SIEVE_PRESIEVE_AVX2
+  if (__builtin_cpu_supports("avx2")) {
+    return combineAvx2;
+  }
+#endif
+  return combineScalar;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+void presieve(const std::uint64_t& low, std::span<std::uint64_t> bitmap) {
+  static const TCombine combine = selectCombine();
+  const std::uint64_t odd_mask = (low % 2 == 0) ? OddBitsMask : ~OddBitsMask;
+  // Pattern word k starts at 64 * k, which is congruent to low for
+  // k = low * 64^(-1) modulo the pattern size
+  std::uint64_t ind_a = low % ModulusA * InverseA % ModulusA;
+  std::uint64_t ind_b = low % ModulusB * InverseB % ModulusB;
+  const std::size_t words_count = bitmap.size();
+  // Both patterns are read contiguously until one of them wraps around
+  for (std::size_t i = 0; i < words_count;) {
+    const std::size_t run =
+        std::min({words_count - i, ModulusA - ind_a, ModulusB - ind_b});
+    combine(PatternA.data() + ind_a, PatternB.data() + ind_b, odd_mask,
+            bitmap.data() + i, run);
+    i += run;
+    ind_a = (ind_a + run) % ModulusA;
+    ind_b = (ind_b + run) % ModulusB;
+  }
+  const std::uint64_t bits_count = 64 * words_count;
+  // Presieve primes and 2 themselves were cleared, 1 was not
+  auto set_bit = [&low, &bits_count, &bitmap](const std::uint64_t& x,
+                                              const bool& value) {
+    if (x >= low && x - low < bits_count) {
+      const std::uint64_t offset = x - low;
+      if (value) {
+        bitmap[offset / 64] |= 1ULL << (offset % 64);
+      } else {
+        bitmap[offset / 64] &= ~(1ULL << (offset % 64));
+      }
+    }
+  };
+  set_bit(1, false);
+  set_bit(2, true);
+  for (const std::uint64_t& prime : PresievePrimes) {
+    set_bit(prime, true);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace NAds::NAlgo::NSieve
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <array>
+#include <span>
+#include <cstdint>
+
+namespace NAds::NAlgo::NSieve {
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Multiples of these primes are cleared by presieve() with precomputed
+// periodic patterns, sieves cross off only greater primes
+inline constexpr std::array<std::uint64_t, 6> PresievePrimes = {3,  5,  7,
+                                                                11, 13, 17};
+
+// Initializes bitmap of numbers [low, low + 64 * bitmap.size()): bit i is set
+// iff low + i is not 0, 1, an even number greater than 2 or a proper multiple
+// of PresievePrimes. Patterns are combined word by word with AVX2 when the
+// CPU supports it, otherwise with scalar 64-bit operations.
+void presieve(const std::uint64_t& low, std::span<std::uint64_t> bitmap);
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace NAds::NAlgo::NSieve
@@ -0,0 +1,297 @@
+#include "prime_pi.hpp"
+#include "segmented_sieve.hpp"
+#include "integer_root.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace NAds::NAlgo::NSieve {
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Below this bound plain segmented sieve is faster
+constexpr std::uint64_t SieveThreshold = 10'000'000;
+
+constexpr double AlphaLogDivisor = 14.0;
+
+// phi(n, c) for the first c = 6 primes is periodic with period
+// 2 * 3 * 5 * 7 * 11 * 13 = 30030
+constexpr std::size_t TinyPrimesCount = 6;
+constexpr std::array<std::uint64_t, TinyPrimesCount> TinyPrimes = {2,  3,  5,
+                                                                   7, 11, 13};
+constexpr std::uint64_t TinyPrimorial = 30030;
+constexpr std::uint64_t TinyPrimorialTotient = 5760;
+
+// phi(n, a) is the number of integers in [1, n] not divisible by any of the
+// first a primes
+class TPhiTiny {
+public:
+  TPhiTiny()
+      : Counts_(TinyPrimorial) {
+    std::vector<bool> is_coprime(TinyPrimorial, true);
+    for (const std::uint64_t& prime : TinyPrimes) {
+      for (std::uint64_t i = 0; i < TinyPrimorial; i += prime) {
+        is_coprime[i] = false;
+      }
+    }
+    std::uint16_t count = 0;
+    for (std::uint64_t i = 0; i < TinyPrimorial; ++i) {
+      if (is_coprime[i]) {
+        ++count;
+      }
+      Counts_[i] = count;
+    }
+  }
+
+  [[nodiscard]] std::uint64_t phi(const std::uint64_t& n) const {
+    return n / TinyPrimorial * TinyPrimorialTotient +
+           Counts_[n % TinyPrimorial];
+  }
+
+private:
+  std::vector<std::uint16_t> Counts_;
+};
+
+// Least prime factor and Moebius function of every n in [1, y]
+struct TSmallTables {
+  explicit TSmallTables(const std::uint64_t& y)
+      : Lpf(y + 1, 0),
+        Mu(y + 1, 1),
+        Primes(1, 0) {
+    for (std::uint64_t i = 2; i <= y; ++i) {
+      if (Lpf[i] != 0) {
+        continue;
+      }
+      Primes.push_back(i);
+      for (std::uint64_t j = i; j <= y; j += i) {
+        if (Lpf[j] == 0) {
+          Lpf[j] = static_cast<std::uint32_t>(i);
+        }
+        Mu[j] = static_cast<std::int8_t>(-Mu[j]);
+      }
+      for (std::uint64_t j = i * i; j <= y; j += i * i) {
+        Mu[j] = 0;
+      }
+    }
+    Lpf[1] = std::numeric_limits<std::uint32_t>::max();
+  }
+
+  std::vector<std::uint32_t> Lpf;
+  std::vector<std::int8_t> Mu;
+  // Primes up to y, Primes[i] is the i-th prime, Primes[0] is unused
+  std::vector<std::uint64_t> Primes;
+};
+
+// Fenwick tree over the sieve of one segment, counts unsieved numbers
+class TCountTree {
+public:
+  void build(const std::vector<std::uint8_t>& sieve, const std::size_t& size) {
+    Tree_.assign(size + 1, 0);
+    for (std::size_t i = 1; i <= size; ++i) {
+      Tree_[i] += sieve[i - 1];
+      const std::size_t parent = i + (i & (~i + 1));
+      if (parent <= size) {
+        Tree_[parent] += Tree_[i];
+      }
+    }
+  }
+
+  void remove(const std::size_t& pos) {
+    for (std::size_t i = pos + 1; i < Tree_.size(); i += i & (~i + 1)) {
+      --Tree_[i];
+    }
+  }
+
+  // Number of unsieved numbers at positions [0, pos]
+  [[nodiscard]] std::int64_t prefixCount(const std::size_t& pos) const {
+    std::int64_t count = 0;
+    for (std::size_t i = pos + 1; i > 0; i &= i - 1) {
+      count += Tree_[i];
+    }
+    return count;
+  }
+
+private:
+  std::vector<std::int32_t> Tree_;
+};
+
+// pi(v) for non-decreasing v by streaming TSegmentedSieve over [0, limit]
+class TPrimeCounter {
+public:
+  explicit TPrimeCounter(const std::uint64_t& limit)
+      : Sieve_(limit),
+        HasSegment_(false),
+        WordInd_(0),
+        Count_(0) {}
+
+  [[nodiscard]] std::uint64_t pi(const std::uint64_t& v) {
+    while (!HasSegment_ || v > Sieve_.segmentHigh()) {
+      if (HasSegment_) {
+        addWordsBefore(Sieve_.segmentBitmap().size());
+      }
+      HasSegment_ = Sieve_.nextSegment();
+      WordInd_ = 0;
+    }
+    const std::uint64_t offset = v - Sieve_.segmentLow();
+    const std::size_t word_ind = offset / 64;
+    addWordsBefore(word_ind);
+    const std::uint64_t bit = offset % 64;
+    const std::uint64_t mask = (bit == 63 ? ~0ULL : (1ULL << (bit + 1)) - 1);
+    return Count_ + static_cast<std::uint64_t>(std::popcount(
+                        Sieve_.segmentBitmap()[word_ind] & mask));
+  }
+
+private:
+  void addWordsBefore(const std::size_t& word_ind) {
+    const std::span<const std::uint64_t> bitmap = Sieve_.segmentBitmap();
+    for (; WordInd_ < word_ind; ++WordInd_) {
+      Count_ += static_cast<std::uint64_t>(std::popcount(bitmap[WordInd_]));
+    }
+  }
+
+  TSegmentedSieve Sieve_;
+  bool HasSegment_;
+  std::size_t WordInd_;
+  std::uint64_t Count_;
+};
+
+// Sum of mu(n) * phi(x / n, c) over square-free n <= y with lpf(n) > p_c
+[[nodiscard]] std::int64_t ordinaryLeaves(const std::uint64_t& x,
+                                          const std::uint64_t& y,
+                                          const TSmallTables& tables,
+                                          const TPhiTiny& phi_tiny) {
+  std::int64_t result = 0;
+  for (std::uint64_t n = 1; n <= y; ++n) {
+    if (tables.Mu[n] != 0 && tables.Lpf[n] > TinyPrimes.back()) {
+      result += tables.Mu[n] * static_cast<std::int64_t>(phi_tiny.phi(x / n));
+    }
+  }
+  return result;
+}
+
+// Sum of -mu(m) * phi(x / (p_b * m), b - 1) over c < b < pi(y) and
+// square-free m with y / p_b < m <= y, lpf(m) > p_b. Values phi(n, b - 1)
+// for n in [1, x / y] are obtained from a segmented sieve where multiples of
+// the first b - 1 primes are crossed off, counts are kept in a Fenwick tree.
+[[nodiscard]] std::int64_t specialLeaves(const std::uint64_t& x,
+                                         const std::uint64_t& y,
+                                         const TSmallTables& tables) {
+  const std::uint64_t limit = x / y + 1;
+  const std::uint64_t segment_size =
+      std::max<std::uint64_t>(std::bit_ceil(integerSqrt(limit)), 64);
+  const std::size_t pi_y = tables.Primes.size() - 1;
+  std::vector<std::uint64_t> next_multiples = tables.Primes;
+  std::vector<std::int64_t> phi(tables.Primes.size(), 0);
+  std::vector<std::uint8_t> sieve(segment_size);
+  TCountTree tree;
+  std::int64_t result = 0;
+  for (std::uint64_t low = 1; low < limit; low += segment_size) {
+    const std::uint64_t high = std::min(low + segment_size, limit);
+    const std::size_t size = high - low;
+    std::fill(sieve.begin(), sieve.begin() + static_cast<std::ptrdiff_t>(size),
+              1);
+    for (std::size_t b = 1; b <= TinyPrimesCount; ++b) {
+      const std::uint64_t prime = tables.Primes[b];
+      std::uint64_t multiple = next_multiples[b];
+      for (; multiple < high; multiple += prime) {
+        sieve[multiple - low] = 0;
+      }
+      next_multiples[b] = multiple;
+    }
+    tree.build(sieve, size);
+    for (std::size_t b = TinyPrimesCount + 1; b < pi_y; ++b) {
+      const std::uint64_t prime = tables.Primes[b];
+      const std::uint64_t min_m = std::max(x / (prime * high), y / prime);
+      const std::uint64_t max_m = std::min(x / (prime * low), y);
+      if (prime >= max_m) {
+        // Larger primes have no leaves in this and further segments
+        break;
+      }
+      for (std::uint64_t m = max_m; m > min_m; --m) {
+        if (tables.Mu[m] != 0 && prime < tables.Lpf[m]) {
+          const std::uint64_t n = x / (prime * m);
+          result -= tables.Mu[m] * (phi[b] + tree.prefixCount(n - low));
+        }
+      }
+      phi[b] += tree.prefixCount(size - 1);
+      std::uint64_t multiple = next_multiples[b];
+      for (; multiple < high; multiple += prime) {
+        if (sieve[multiple - low] != 0) {
+          sieve[multiple - low] = 0;
+          tree.remove(multiple - low);
+        }
+      }
+      next_multiples[b] = multiple;
+    }
+  }
+  return result;
+}
+
+// Sum of pi(x / p) - pi(p) + 1 over primes y < p <= sqrt(x). Primes p are
+// enumerated in decreasing order window by window, so that x / p increases
+// and pi(x / p) is streamed by one ascending sieve.
+[[nodiscard]] std::int64_t partialSieveP2(const std::uint64_t& x,
+                                          const std::uint64_t& y) {
+  const std::uint64_t sqrt_x = integerSqrt(x);
+  if (sqrt_x <= y) {
+    return 0;
+  }
+  TPrimeCounter counter(x / (y + 1));
+  std::uint64_t pi_p = countPrimes(sqrt_x);
+  std::int64_t result = 0;
+  std::vector<std::uint64_t> window_primes;
+  for (std::uint64_t high = sqrt_x; high > y;) {
+    const std::uint64_t window_size = TSegmentedSieve::DefaultSegmentSize;
+    const std::uint64_t low =
+        (high - y > window_size) ? high - window_size + 1 : y + 1;
+    window_primes.clear();
+    TSegmentedSieve sieve(createBasePrimes(high), low, high);
+    sieve.forEachPrime([&window_primes](const std::uint64_t& prime) {
+      window_primes.push_back(prime);
+    });
+    for (auto it = window_primes.rbegin(); it != window_primes.rend(); ++it) {
+      result += static_cast<std::int64_t>(counter.pi(x / *it)) -
+                static_cast<std::int64_t>(pi_p) + 1;
+      --pi_p;
+    }
+    high = low - 1;
+  }
+  return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+[[nodiscard]] std::uint64_t primePi(const std::uint64_t& x) {
+  if (x < SieveThreshold) {
+    return countPrimes(x);
+  }
+  // y = alpha * x^(1/3) balances the number of special leaves against the
+  // length of the sieve over [1, x / y], alpha ~ 2 was tuned for x ~ 10^13
+  const double alpha =
+      std::max(1.0, std::log(static_cast<double>(x)) / AlphaLogDivisor);
+  const std::uint64_t y = std::min(
+      static_cast<std::uint64_t>(alpha * static_cast<double>(integerCbrt(x))),
+      integerSqrt(x) - 1);
+  const TSmallTables tables(y);
+  const TPhiTiny phi_tiny;
+  const std::int64_t phi = ordinaryLeaves(x, y, tables, phi_tiny) +
+                           specialLeaves(x, y, tables);
+  const auto pi_y = static_cast<std::int64_t>(tables.Primes.size() - 1);
+  return static_cast<std::uint64_t>(phi + pi_y - 1 - partialSieveP2(x, y));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace NAds::NAlgo::NSieve
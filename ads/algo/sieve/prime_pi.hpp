@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstdint>
+
+namespace NAds::NAlgo::NSieve {
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Number of primes in [0, x] by Lagarias-Miller-Odlyzko algorithm:
+// pi(x) = phi(x, a) + a - 1 - P2(x, a), a = pi(y), y ~ x^(1/3).
+// Special leaves of phi are counted with a segmented sieve over [1, x / y]
+// and P2 with TSegmentedSieve. Small x fall back to countPrimes(x).
+// Time: O(x^(2/3)), additional memory: O(x^(1/3))
+[[nodiscard]] std::uint64_t primePi(const std::uint64_t& x);
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace NAds::NAlgo::NSieve
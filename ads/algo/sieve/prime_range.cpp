@@ -0,0 +1,118 @@
+#include "prime_range.hpp"
+
+#include <bit>
+
+namespace NAds::NAlgo::NSieve {
+
+////////////////////////////////////////////////////////////////////////////////
+
+TPrimeRange::TPrimeRange(const std::uint64_t& from, const std::uint64_t& to)
+    : To_(to),
+      NextWindowLow_(from),
+      WindowSize_(TSegmentedSieve::DefaultSegmentSize),
+      IsLastWindow_(false),
+      IsStarted_(false),
+      IsExhausted_(from > to),
+      WordInd_(0),
+      Word_(0),
+      WordLow_(0),
+      Current_(0) {}
+
+[[nodiscard]] TPrimeRange::TIterator TPrimeRange::begin() {
+  if (!IsStarted_) {
+    IsStarted_ = true;
+    advance();
+  }
+  return TIterator(this);
+}
+
+[[nodiscard]] std::default_sentinel_t TPrimeRange::end() const noexcept {
+  return std::default_sentinel;
+}
+
+bool TPrimeRange::advance() {
+  if (IsExhausted_) {
+    return false;
+  }
+  while (Word_ == 0) {
+    if (Sieve_.has_value() && WordInd_ < Sieve_->segmentBitmap().size()) {
+      WordLow_ = Sieve_->segmentLow() + WordInd_ * 64;
+      Word_ = Sieve_->segmentBitmap()[WordInd_];
+      ++WordInd_;
+    } else if (!nextSegment()) {
+      IsExhausted_ = true;
+      return false;
+    }
+  }
+  Current_ = WordLow_ + static_cast<std::uint64_t>(std::countr_zero(Word_));
+  Word_ &= Word_ - 1;
+  return true;
+}
+
+bool TPrimeRange::nextSegment() {
+  while (!Sieve_.has_value() || !Sieve_->nextSegment()) {
+    if (Sieve_.has_value() && IsLastWindow_) {
+      return false;
+    }
+    openNextWindow();
+  }
+  WordInd_ = 0;
+  return true;
+}
+
+void TPrimeRange::openNextWindow() {
+  const std::uint64_t low = NextWindowLow_;
+  const std::uint64_t high =
+      (To_ - low < WindowSize_ - 1) ? To_ : low + WindowSize_ - 1;
+  IsLastWindow_ = (high == To_);
+  if (!IsLastWindow_) {
+    NextWindowLow_ = high + 1;
+  }
+  Sieve_.emplace(createBasePrimes(high), low, high);
+  if (WindowSize_ <= std::numeric_limits<std::uint64_t>::max() / 2) {
+    WindowSize_ *= 2;
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TPrimeRange::TIterator::TIterator(TPrimeRange* range) noexcept
+    : Range_(range) {}
+
+[[nodiscard]] std::uint64_t TPrimeRange::TIterator::operator*()
+    const noexcept {
+  return Range_->Current_;
+}
+
+TPrimeRange::TIterator& TPrimeRange::TIterator::operator++() {
+  Range_->advance();
+  return *this;
+}
+
+void TPrimeRange::TIterator::operator++(int) {
+  Range_->advance();
+}
+
+[[nodiscard]] bool TPrimeRange::TIterator::isEnd() const noexcept {
+  return Range_ == nullptr || Range_->IsExhausted_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+[[nodiscard]] std::vector<std::uint64_t> nextPrimes(const std::uint64_t& x,
+                                                    const std::size_t& count) {
+  std::vector<std::uint64_t> primes;
+  if (x == std::numeric_limits<std::uint64_t>::max()) {
+    return primes;
+  }
+  primes.reserve(count);
+  TPrimeRange range(x + 1);
+  for (const std::uint64_t prime : range | std::views::take(count)) {
+    primes.push_back(prime);
+  }
+  return primes;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace NAds::NAlgo::NSieve
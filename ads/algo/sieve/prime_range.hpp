@@ -0,0 +1,94 @@
+#pragma once
+
+#include "segmented_sieve.hpp"
+
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <ranges>
+
+namespace NAds::NAlgo::NSieve {
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Single pass input view over primes in [from, to] which are generated lazily
+// segment by segment. The range is sieved in windows of doubling size, so
+// only base primes up to sqrt of the current window and one segment bitmap
+// are kept in memory. Primes are extracted from 64-bit bitmap words by ctz.
+//
+// Example: the first 10 primes after x
+//   TPrimeRange(x + 1) | std::views::take(10)
+class TPrimeRange : public std::ranges::view_interface<TPrimeRange> {
+public:
+  class TIterator;
+
+  explicit TPrimeRange(
+      const std::uint64_t& from = 0,
+      const std::uint64_t& to = std::numeric_limits<std::uint64_t>::max());
+
+  // Sieves the first segment, subsequent calls continue from the current
+  // position since the view is single pass
+  [[nodiscard]] TIterator begin();
+
+  [[nodiscard]] std::default_sentinel_t end() const noexcept;
+
+private:
+  // Moves to the next prime, returns false if there are no primes left
+  bool advance();
+
+  bool nextSegment();
+
+  void openNextWindow();
+
+  std::uint64_t To_;
+  std::uint64_t NextWindowLow_;
+  std::uint64_t WindowSize_;
+  bool IsLastWindow_;
+  bool IsStarted_;
+  bool IsExhausted_;
+  std::optional<TSegmentedSieve> Sieve_;
+  std::size_t WordInd_;
+  std::uint64_t Word_;
+  std::uint64_t WordLow_;
+  std::uint64_t Current_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+class TPrimeRange::TIterator {
+public:
+  // Names are required by std::input_iterator
+  using iterator_concept = std::input_iterator_tag;  // NOLINT
+  using value_type = std::uint64_t;                  // NOLINT
+  using difference_type = std::ptrdiff_t;            // NOLINT
+
+  TIterator() = default;
+
+  explicit TIterator(TPrimeRange* range) noexcept;
+
+  [[nodiscard]] std::uint64_t operator*() const noexcept;
+
+  TIterator& operator++();
+
+  void operator++(int);
+
+  [[nodiscard]] friend bool operator==(const TIterator& it,
+                                       std::default_sentinel_t) noexcept {
+    return it.isEnd();
+  }
+
+private:
+  [[nodiscard]] bool isEnd() const noexcept;
+
+  TPrimeRange* Range_ = nullptr;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+// First count primes greater than x
+[[nodiscard]] std::vector<std::uint64_t> nextPrimes(const std::uint64_t& x,
+                                                    const std::size_t& count);
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace NAds::NAlgo::NSieve
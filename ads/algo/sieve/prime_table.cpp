@@ -0,0 +1,157 @@
+#include "prime_table.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <utility>
+
+namespace NAds::NAlgo::NSieve {
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+
+static_assert(sizeof(TPrimeTableHeader) == 40,
+              "Prime table header layout must not change within a version");
+
+[[nodiscard]] TPrimeTableHeader validateHeader(const void* address,
+                                               const std::size_t& file_size) {
+  if (file_size < sizeof(TPrimeTableHeader)) {
+    throw std::runtime_error("Prime table file is too small");
+  }
+  TPrimeTableHeader header{};
+  std::memcpy(&header, address, sizeof(TPrimeTableHeader));
+  if (header.Magic != TPrimeTableHeader::ExpectedMagic) {
+    throw std::runtime_error("File is not a prime table");
+  }
+  if (header.Version != TPrimeTableHeader::CurrentVersion) {
+    throw std::runtime_error("Unsupported prime table version " +
+                             std::to_string(header.Version));
+  }
+  if (header.Encoding != TPrimeTableHeader::WheelEncoding) {
+    throw std::runtime_error("Unsupported prime table encoding");
+  }
+  if (header.Limit == 0 ||
+      header.DataSize != header.Limit / TWheelSieveView::WheelSize + 1 ||
+      header.DataSize != file_size - sizeof(TPrimeTableHeader)) {
+    throw std::runtime_error("Prime table file is corrupted");
+  }
+  return header;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+void savePrimeTable(const TWheelSieveView& table, const std::string& path) {
+  const std::span<const std::uint8_t> bits = table.bits();
+  const TPrimeTableHeader header{.Magic = TPrimeTableHeader::ExpectedMagic,
+                                 .Version = TPrimeTableHeader::CurrentVersion,
+                                 .Encoding = TPrimeTableHeader::WheelEncoding,
+                                 .Limit = table.limit(),
+                                 .DataSize = bits.size(),
+                                 .PrimesCount = table.count()};
+  std::ofstream out(path, std::ios::binary | std::ios::trunc);
+  if (!out) {
+    throw std::runtime_error("Unable to open " + path + " for writing");
+  }
+  out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  out.write(reinterpret_cast<const char*>(bits.data()),
+            static_cast<std::streamsize>(bits.size()));
+  if (!out) {
+    throw std::runtime_error("Unable to write prime table to " + path);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TMappedPrimeTable::TMappedPrimeTable(const std::string& path)
+    : Address_(nullptr),
+      Size_(0),
+      Header_() {
+  const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd == -1) {
+    throw std::runtime_error("Unable to open " + path);
+  }
+  struct stat file_stat{};
+  if (::fstat(fd, &file_stat) == -1 || file_stat.st_size <= 0) {
+    ::close(fd);
+    throw std::runtime_error("Unable to map empty or unreadable " + path);
+  }
+  const auto file_size = static_cast<std::size_t>(file_stat.st_size);
+  void* address = ::mmap(nullptr, file_size, PROT_READ, MAP_SHARED, fd, 0);
+  // The mapping keeps the file referenced
+  ::close(fd);
+  if (address == MAP_FAILED) {
+    throw std::runtime_error("Unable to map " + path);
+  }
+  Address_ = address;
+  Size_ = file_size;
+  try {
+    Header_ = validateHeader(Address_, Size_);
+  } catch (...) {
+    unmap();
+    throw;
+  }
+}
+
+TMappedPrimeTable::TMappedPrimeTable(TMappedPrimeTable&& other) noexcept
+    : Address_(std::exchange(other.Address_, nullptr)),
+      Size_(std::exchange(other.Size_, 0)),
+      Header_(other.Header_) {}
+
+TMappedPrimeTable& TMappedPrimeTable::operator=(
+    TMappedPrimeTable&& other) noexcept {
+  if (this != &other) {
+    unmap();
+    Address_ = std::exchange(other.Address_, nullptr);
+    Size_ = std::exchange(other.Size_, 0);
+    Header_ = other.Header_;
+  }
+  return *this;
+}
+
+TMappedPrimeTable::~TMappedPrimeTable() {
+  unmap();
+}
+
+[[nodiscard]] TWheelSieveView TMappedPrimeTable::view() const {
+  if (Address_ == nullptr) {
+    throw std::runtime_error("Prime table is not mapped");
+  }
+  const auto* data =
+      static_cast<const std::uint8_t*>(Address_) + sizeof(TPrimeTableHeader);
+  return TWheelSieveView(Header_.Limit,
+                         std::span<const std::uint8_t>(data, Header_.DataSize));
+}
+
+[[nodiscard]] std::uint64_t TMappedPrimeTable::count() const noexcept {
+  return Header_.PrimesCount;
+}
+
+void TMappedPrimeTable::unmap() noexcept {
+  if (Address_ != nullptr) {
+    ::munmap(Address_, Size_);
+    Address_ = nullptr;
+    Size_ = 0;
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+[[nodiscard]] TMappedPrimeTable loadPrimeTable(const std::string& path) {
+  return TMappedPrimeTable(path);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace NAds::NAlgo::NSieve
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "wheel_sieve.hpp"
+
+#include <string>
+
+namespace NAds::NAlgo::NSieve {
+
+////////////////////////////////////////////////////////////////////////////////
+
+// On-disk prime table format, version 1 (native little-endian):
+//   TPrimeTableHeader (40 bytes)
+//   mod 30 wheel table of [0, Limit], DataSize = Limit / 30 + 1 bytes
+struct TPrimeTableHeader {
+  static constexpr std::array<char, 8> ExpectedMagic = {'A', 'D', 'S', 'P',
+                                                        'R', 'I', 'M', 'E'};
+  static constexpr std::uint32_t CurrentVersion = 1;
+  static constexpr std::uint32_t WheelEncoding = 1;
+
+  std::array<char, 8> Magic;
+  std::uint32_t Version;
+  std::uint32_t Encoding;
+  std::uint64_t Limit;
+  std::uint64_t DataSize;
+  std::uint64_t PrimesCount;
+};
+
+void savePrimeTable(const TWheelSieveView& table, const std::string& path);
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Prime table file mapped read-only into memory. Pages are shared between all
+// processes which map the same file, so loading costs no sieving and no copy.
+class TMappedPrimeTable {
+public:
+  explicit TMappedPrimeTable(const std::string& path);
+
+  TMappedPrimeTable(const TMappedPrimeTable& other) = delete;
+
+  TMappedPrimeTable& operator=(const TMappedPrimeTable& other) = delete;
+
+  TMappedPrimeTable(TMappedPrimeTable&& other) noexcept;
+
+  TMappedPrimeTable& operator=(TMappedPrimeTable&& other) noexcept;
+
+  ~TMappedPrimeTable();
+
+  // Valid while this object is alive
+  [[nodiscard]] TWheelSieveView view() const;
+
+  // Number of primes stored in the header, O(1)
+  [[nodiscard]] std::uint64_t count() const noexcept;
+
+private:
+  void unmap() noexcept;
+
+  void* Address_;
+  std::size_t Size_;
+  TPrimeTableHeader Header_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Same as TMappedPrimeTable(path)
+[[nodiscard]] TMappedPrimeTable loadPrimeTable(const std::string& path);
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace NAds::NAlgo::NSieve
@@ -0,0 +1,28 @@
+#ifndef ADS_ALGO_SIEVE_RANGE_SIEVE_INL_HPP_
+#error "Direct inclusion of this file is not allowed, include range_sieve.hpp"
+// For the sake of sane code completion.
+#include "range_sieve.hpp"
+#endif
+
+#include <bit>
+
+namespace NAds::NAlgo::NSieve {
+
+////////////////////////////////////////////////////////////////////////////////
+
+template <typename TCallback>
+void TRangeSieve::forEachPrime(TCallback&& callback) const {
+  const std::size_t words_count = Bitmap_.size();
+  for (std::size_t i = 0; i < words_count; ++i) {
+    std::uint64_t word = Bitmap_[i];
+    while (word != 0) {
+      const auto bit = static_cast<std::uint64_t>(std::countr_zero(word));
+      callback(Low_ + i * 64 + bit);
+      word &= word - 1;
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace NAds::NAlgo::NSieve
@@ -0,0 +1,177 @@
+#include "range_sieve.hpp"
+#include "segmented_sieve.hpp"
+#include "integer_root.hpp"
+#include "presieve.hpp"
+
+#include <stdexcept>
+#include <algorithm>
+#include <bit>
+
+namespace NAds::NAlgo::NSieve {
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Base primes are handed to the windows in blocks of this size, 256 KiB
+constexpr std::size_t BasePrimesBlockSize = 1ULL << 16;
+
+// Calls callback(block) for consecutive blocks of primes in
+// (PresievePrimes.back(), sqrt(limit)]. Only one base segment and one block
+// are kept in memory.
+template <typename TCallback>
+void forEachBasePrimesBlock(const std::uint64_t& limit, TCallback&& callback) {
+  std::vector<std::uint32_t> block;
+  block.reserve(BasePrimesBlockSize);
+  TSegmentedSieve base_sieve(integerSqrt(limit));
+  base_sieve.forEachPrime([&block, &callback](const std::uint64_t& prime) {
+    if (prime <= PresievePrimes.back()) {
+      return;
+    }
+    block.push_back(static_cast<std::uint32_t>(prime));
+    if (block.size() == BasePrimesBlockSize) {
+      callback(std::span<const std::uint32_t>(block));
+      block.clear();
+    }
+  });
+  if (!block.empty()) {
+    callback(std::span<const std::uint32_t>(block));
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+[[nodiscard]] std::vector<TRangeSieve> rangeSieveBatch(
+    std::span<const TRangeWindow> windows, const std::size_t& thread_count) {
+  std::vector<TRangeSieve> sieves;
+  if (windows.empty()) {
+    return sieves;
+  }
+  sieves.reserve(windows.size());
+  for (const TRangeWindow& window : windows) {
+    sieves.push_back(TRangeSieve(window));
+  }
+  // Window i belongs to group i % groups_count, so wide and narrow windows
+  // given in order are spread over the groups
+  const std::size_t groups_count =
+      std::min(std::max<std::size_t>(thread_count, 1), sieves.size());
+  NParallel::parallelFor(
+      groups_count, groups_count,
+      [&sieves, groups_count](const std::size_t& group) {
+        std::uint64_t max_high = 0;
+        for (std::size_t i = group; i < sieves.size(); i += groups_count) {
+          max_high = std::max(max_high, sieves[i].High_);
+        }
+        forEachBasePrimesBlock(
+            max_high, [&sieves, group,
+                       groups_count](std::span<const std::uint32_t> block) {
+              for (std::size_t i = group; i < sieves.size();
+                   i += groups_count) {
+                TRangeSieve& sieve = sieves[i];
+                for (const std::uint32_t& base_prime : block) {
+                  const std::uint64_t prime = base_prime;
+                  if (prime * prime > sieve.High_) {
+                    break;
+                  }
+                  sieve.crossOff(prime);
+                }
+              }
+            });
+      });
+  return sieves;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TRangeSieve::TRangeSieve(const std::uint64_t& low, const std::uint64_t& high)
+    : TRangeSieve(TRangeWindow{.Low = low, .High = high}) {
+  forEachBasePrimesBlock(High_, [this](std::span<const std::uint32_t> block) {
+    for (const std::uint32_t& prime : block) {
+      crossOff(prime);
+    }
+  });
+}
+
+TRangeSieve::TRangeSieve(const TRangeWindow& window)
+    : Low_(window.Low),
+      High_(window.High) {
+  if (Low_ > High_) {
+    throw std::range_error("Left bound must be not greater than right one");
+  }
+  Bitmap_.resize((High_ - Low_) / 64 + 1);
+  presieve(Low_, Bitmap_);
+  const std::uint64_t tail_bits = (High_ - Low_ + 1) % 64;
+  if (tail_bits != 0) {
+    Bitmap_.back() &= (1ULL << tail_bits) - 1;
+  }
+}
+
+[[nodiscard]] std::uint64_t TRangeSieve::low() const noexcept {
+  return Low_;
+}
+
+[[nodiscard]] std::uint64_t TRangeSieve::high() const noexcept {
+  return High_;
+}
+
+[[nodiscard]] std::span<const std::uint64_t> TRangeSieve::bitmap()
+    const noexcept {
+  return Bitmap_;
+}
+
+[[nodiscard]] bool TRangeSieve::isPrime(const std::uint64_t& x) const {
+  if (x < Low_ || x > High_) {
+    throw std::out_of_range("Number is out of the window");
+  }
+  const std::uint64_t offset = x - Low_;
+  return ((Bitmap_[offset / 64] >> (offset % 64)) & 1ULL) != 0;
+}
+
+[[nodiscard]] std::uint64_t TRangeSieve::count() const noexcept {
+  std::uint64_t result = 0;
+  for (const std::uint64_t& word : Bitmap_) {
+    result += static_cast<std::uint64_t>(std::popcount(word));
+  }
+  return result;
+}
+
+[[nodiscard]] std::vector<std::uint64_t> TRangeSieve::primes() const {
+  std::vector<std::uint64_t> result;
+  forEachPrime(
+      [&result](const std::uint64_t& prime) { result.push_back(prime); });
+  return result;
+}
+
+[[nodiscard]] std::size_t TRangeSieve::memoryUsage() const noexcept {
+  return Bitmap_.size() * sizeof(std::uint64_t);
+}
+
+// Offsets from Low_ are used instead of absolute values, so that windows
+// near 2^64 do not overflow
+void TRangeSieve::crossOff(const std::uint64_t& prime) {
+  const std::uint64_t size = High_ - Low_ + 1;
+  const std::uint64_t remainder = Low_ % prime;
+  std::uint64_t offset = (remainder == 0) ? 0 : prime - remainder;
+  // Low_ + offset is a multiple of odd prime, make it odd
+  if ((Low_ % 2 + offset % 2) % 2 == 0) {
+    offset += prime;
+  }
+  const std::uint64_t square = prime * prime;
+  if (square >= Low_ && square - Low_ > offset) {
+    offset = square - Low_;
+  }
+  const std::uint64_t step = 2 * prime;
+  for (; offset < size; offset += step) {
+    Bitmap_[offset / 64] &= ~(1ULL << (offset % 64));
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace NAds::NAlgo::NSieve
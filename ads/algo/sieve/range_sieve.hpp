@@ -0,0 +1,83 @@
+#pragma once
+
+#include "algo/parallel/parallel_for.hpp"
+
+#include <vector>
+#include <span>
+#include <cstdint>
+
+namespace NAds::NAlgo::NSieve {
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Bounds of a TRangeSieve window (inclusive)
+struct TRangeWindow {
+  std::uint64_t Low;
+  std::uint64_t High;
+};
+
+class TRangeSieve;
+
+// Sieves the windows on thread_count threads started once per batch. The
+// windows are split into one group per thread, and every thread streams the
+// base primes of its group block by block and crosses each block off in all
+// windows of the group, so the base primes are generated once per thread
+// instead of once per window, in parallel.
+[[nodiscard]] std::vector<TRangeSieve> rangeSieveBatch(
+    std::span<const TRangeWindow> windows,
+    const std::size_t& thread_count = NParallel::defaultThreadCount());
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Sieve of Eratosthenes over a window [low, high] with arbitrary large low,
+// e.g. [10^18, 10^18 + 10^7]. Base primes up to sqrt(high) are streamed by
+// TSegmentedSieve and never stored, so memory is O(high - low) bits plus
+// one base segment.
+class TRangeSieve {
+public:
+  TRangeSieve(const std::uint64_t& low, const std::uint64_t& high);
+
+  [[nodiscard]] std::uint64_t low() const noexcept;
+
+  [[nodiscard]] std::uint64_t high() const noexcept;
+
+  // Bit i of the bitmap is set iff low() + i is prime
+  [[nodiscard]] std::span<const std::uint64_t> bitmap() const noexcept;
+
+  // x must belong to [low(), high()]
+  [[nodiscard]] bool isPrime(const std::uint64_t& x) const;
+
+  // Number of primes in [low(), high()]
+  [[nodiscard]] std::uint64_t count() const noexcept;
+
+  // Calls callback(prime) for every prime of the window in increasing order
+  template <typename TCallback>
+  void forEachPrime(TCallback&& callback) const;
+
+  [[nodiscard]] std::vector<std::uint64_t> primes() const;
+
+  // Size of the bitmap in bytes
+  [[nodiscard]] std::size_t memoryUsage() const noexcept;
+
+private:
+  friend std::vector<TRangeSieve> rangeSieveBatch(
+      std::span<const TRangeWindow> windows, const std::size_t& thread_count);
+
+  // Only multiples of 2 and PresievePrimes are crossed off
+  explicit TRangeSieve(const TRangeWindow& window);
+
+  // Crosses off odd multiples of odd prime starting from prime^2
+  void crossOff(const std::uint64_t& prime);
+
+  std::uint64_t Low_;
+  std::uint64_t High_;
+  std::vector<std::uint64_t> Bitmap_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace NAds::NAlgo::NSieve
+
+#define ADS_ALGO_SIEVE_RANGE_SIEVE_INL_HPP_
+#include "range_sieve-inl.hpp"
+#undef ADS_ALGO_SIEVE_RANGE_SIEVE_INL_HPP_
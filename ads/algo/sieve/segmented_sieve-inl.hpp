@@ -0,0 +1,35 @@
+#ifndef ADS_ALGO_SIEVE_SEGMENTED_SIEVE_INL_HPP_
+#error "Direct inclusion of this file is not allowed, include segmented_sieve.hpp"
+// For the sake of sane code completion.
+#include "segmented_sieve.hpp"
+#endif
+
+#include <bit>
+
+namespace NAds::NAlgo::NSieve {
+
+////////////////////////////////////////////////////////////////////////////////
+
+template <typename TCallback>
+void TSegmentedSieve::forEachSegmentPrime(TCallback&& callback) const {
+  const std::size_t words_count = Bitmap_.size();
+  for (std::size_t i = 0; i < words_count; ++i) {
+    std::uint64_t word = Bitmap_[i];
+    while (word != 0) {
+      const auto bit = static_cast<std::uint64_t>(std::countr_zero(word));
+      callback(Low_ + i * 64 + bit);
+      word &= word - 1;
+    }
+  }
+}
+
+template <typename TCallback>
+void TSegmentedSieve::forEachPrime(TCallback&& callback) {
+  while (nextSegment()) {
+    forEachSegmentPrime(callback);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace NAds::NAlgo::NSieve
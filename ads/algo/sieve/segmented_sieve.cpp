@@ -0,0 +1,153 @@
+#include "segmented_sieve.hpp"
+#include "sieve.hpp"
+#include "integer_root.hpp"
+#include "presieve.hpp"
+
+#include <stdexcept>
+#include <bit>
+#include <algorithm>
+#include <utility>
+
+namespace NAds::NAlgo::NSieve {
+
+////////////////////////////////////////////////////////////////////////////////
+
+[[nodiscard]] std::vector<std::uint32_t> createBasePrimes(
+    const std::uint64_t& n) {
+  const std::uint64_t sqrt_n = integerSqrt(n);
+  std::vector<std::uint32_t> base_primes;
+  if (sqrt_n >= 3) {
+    const std::vector<bool> is_prime = createEratoSieve(sqrt_n);
+    for (std::size_t i = 3; i <= sqrt_n; i += 2) {
+      if (is_prime[i]) {
+        base_primes.push_back(static_cast<std::uint32_t>(i));
+      }
+    }
+  }
+  return base_primes;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TSegmentedSieve::TSegmentedSieve(const std::uint64_t& n,
+                                 const std::size_t& segment_size)
+    : TSegmentedSieve(createBasePrimes(n), 0ULL, n, segment_size) {}
+
+TSegmentedSieve::TSegmentedSieve(std::vector<std::uint32_t> base_primes,
+                                 const std::uint64_t& low,
+                                 const std::uint64_t& high,
+                                 const std::size_t& segment_size)
+    : RangeHigh_(high),
+      SegmentSize_((segment_size + 63) / 64 * 64),
+      Low_(low),
+      High_(low),
+      NextLow_(low),
+      IsExhausted_(false),
+      BasePrimes_(std::move(base_primes)) {
+  if (segment_size == 0ULL) {
+    throw std::range_error("Segment size must be greater than zero");
+  }
+  if (low > high) {
+    throw std::range_error("Left bound must be not greater than right one");
+  }
+  // Multiples of the smallest primes are cleared by presieve()
+  FirstCrossedPrimeInd_ = static_cast<std::size_t>(
+      std::upper_bound(BasePrimes_.begin(), BasePrimes_.end(),
+                       PresievePrimes.back()) -
+      BasePrimes_.begin());
+  NextMultiples_.reserve(BasePrimes_.size());
+  for (const std::uint32_t& base_prime : BasePrimes_) {
+    const std::uint64_t prime = base_prime;
+    // First odd multiple of prime in [max(low, prime^2), +inf)
+    std::uint64_t multiple = (low + prime - 1) / prime * prime;
+    if (multiple % 2 == 0) {
+      multiple += prime;
+    }
+    NextMultiples_.push_back(std::max(multiple, prime * prime));
+  }
+}
+
+[[nodiscard]] bool TSegmentedSieve::nextSegment() {
+  if (IsExhausted_) {
+    Bitmap_.clear();
+    return false;
+  }
+  Low_ = NextLow_;
+  High_ = (RangeHigh_ - Low_ < SegmentSize_ - 1) ? RangeHigh_
+                                                 : Low_ + SegmentSize_ - 1;
+  if (High_ == RangeHigh_) {
+    IsExhausted_ = true;
+  } else {
+    NextLow_ = High_ + 1;
+  }
+  Bitmap_.resize((High_ - Low_) / 64 + 1);
+  presieve(Low_, Bitmap_);
+  const std::size_t base_primes_count = BasePrimes_.size();
+  for (std::size_t i = FirstCrossedPrimeInd_; i < base_primes_count; ++i) {
+    const std::uint64_t prime = BasePrimes_[i];
+    if (prime * prime > High_) {
+      break;
+    }
+    // Even multiples are already cleared by the initial mask
+    const std::uint64_t step = 2 * prime;
+    std::uint64_t multiple = NextMultiples_[i];
+    for (; multiple <= High_; multiple += step) {
+      const std::uint64_t offset = multiple - Low_;
+      Bitmap_[offset / 64] &= ~(1ULL << (offset % 64));
+    }
+    NextMultiples_[i] = multiple;
+  }
+  const std::uint64_t tail_bits = (High_ - Low_ + 1) % 64;
+  if (tail_bits != 0) {
+    Bitmap_.back() &= (1ULL << tail_bits) - 1;
+  }
+  return true;
+}
+
+[[nodiscard]] std::uint64_t TSegmentedSieve::segmentLow() const noexcept {
+  return Low_;
+}
+
+[[nodiscard]] std::uint64_t TSegmentedSieve::segmentHigh() const noexcept {
+  return High_;
+}
+
+[[nodiscard]] std::span<const std::uint64_t> TSegmentedSieve::segmentBitmap()
+    const noexcept {
+  return Bitmap_;
+}
+
+[[nodiscard]] bool TSegmentedSieve::isPrime(const std::uint64_t& x) const {
+  if (Bitmap_.empty() || x < Low_ || x > High_) {
+    throw std::out_of_range("Number is out of the current segment");
+  }
+  const std::uint64_t offset = x - Low_;
+  return ((Bitmap_[offset / 64] >> (offset % 64)) & 1ULL) != 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+[[nodiscard]] std::vector<std::uint64_t> segmentedSievePrimes(
+    const std::uint64_t& n, const std::size_t& segment_size) {
+  TSegmentedSieve sieve(n, segment_size);
+  std::vector<std::uint64_t> primes;
+  sieve.forEachPrime(
+      [&primes](const std::uint64_t& prime) { primes.push_back(prime); });
+  return primes;
+}
+
+[[nodiscard]] std::uint64_t countPrimes(const std::uint64_t& n,
+                                        const std::size_t& segment_size) {
+  TSegmentedSieve sieve(n, segment_size);
+  std::uint64_t count = 0;
+  while (sieve.nextSegment()) {
+    for (const std::uint64_t& word : sieve.segmentBitmap()) {
+      count += static_cast<std::uint64_t>(std::popcount(word));
+    }
+  }
+  return count;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace NAds::NAlgo::NSieve
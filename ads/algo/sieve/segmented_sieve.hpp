@@ -0,0 +1,87 @@
+#pragma once
+
+#include <vector>
+#include <span>
+#include <cstdint>
+
+namespace NAds::NAlgo::NSieve {
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Odd primes p such that p * p <= n
+[[nodiscard]] std::vector<std::uint32_t> createBasePrimes(
+    const std::uint64_t& n);
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Sieve of Eratosthenes over [0, n] processed in cache-sized segments.
+// Peak memory is O(sqrt(n) + segment_size) regardless of n.
+class TSegmentedSieve {
+public:
+  // 2^18 bits = 32 KiB bitmap, fits into L1 data cache
+  static constexpr std::size_t DefaultSegmentSize = 1ULL << 18;
+
+  explicit TSegmentedSieve(
+      const std::uint64_t& n,
+      const std::size_t& segment_size = DefaultSegmentSize);
+
+  // Sieves [low, high] with base primes precomputed by createBasePrimes(high),
+  // so that several sieves may share one base primes computation
+  TSegmentedSieve(std::vector<std::uint32_t> base_primes,
+                  const std::uint64_t& low, const std::uint64_t& high,
+                  const std::size_t& segment_size = DefaultSegmentSize);
+
+  // Sieves next segment. Returns false when the range is exhausted
+  [[nodiscard]] bool nextSegment();
+
+  // Bounds of the current segment (inclusive)
+  [[nodiscard]] std::uint64_t segmentLow() const noexcept;
+
+  [[nodiscard]] std::uint64_t segmentHigh() const noexcept;
+
+  // Bit i of the bitmap is set iff segmentLow() + i is prime
+  [[nodiscard]] std::span<const std::uint64_t> segmentBitmap() const noexcept;
+
+  // x must belong to the current segment
+  [[nodiscard]] bool isPrime(const std::uint64_t& x) const;
+
+  // Calls callback(prime) for every prime of the current segment
+  template <typename TCallback>
+  void forEachSegmentPrime(TCallback&& callback) const;
+
+  // Streams all remaining primes of the range in increasing order
+  template <typename TCallback>
+  void forEachPrime(TCallback&& callback);
+
+private:
+  std::uint64_t RangeHigh_;
+  std::size_t SegmentSize_;
+  std::uint64_t Low_;
+  std::uint64_t High_;
+  std::uint64_t NextLow_;
+  bool IsExhausted_;
+  // Odd primes up to sqrt(high) and next odd multiple to cross off for each
+  std::vector<std::uint32_t> BasePrimes_;
+  std::vector<std::uint64_t> NextMultiples_;
+  std::size_t FirstCrossedPrimeInd_;
+  std::vector<std::uint64_t> Bitmap_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+[[nodiscard]] std::vector<std::uint64_t> segmentedSievePrimes(
+    const std::uint64_t& n,
+    const std::size_t& segment_size = TSegmentedSieve::DefaultSegmentSize);
+
+// Number of primes in [0, n]
+[[nodiscard]] std::uint64_t countPrimes(
+    const std::uint64_t& n,
+    const std::size_t& segment_size = TSegmentedSieve::DefaultSegmentSize);
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace NAds::NAlgo::NSieve
+
+#define ADS_ALGO_SIEVE_SEGMENTED_SIEVE_INL_HPP_
+#include "segmented_sieve-inl.hpp"
+#undef ADS_ALGO_SIEVE_SEGMENTED_SIEVE_INL_HPP_
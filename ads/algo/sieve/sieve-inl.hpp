@@ -0,0 +1,42 @@
+#ifndef ADS_ALGO_SIEVE_SIEVE_INL_HPP_
+#error "Direct inclusion of this file is not allowed, include sieve.hpp"
+// For the sake of sane code completion.
+#include "sieve.hpp"
+#endif
+
+#include <stdexcept>
+
+namespace NAds::NAlgo::NSieve {
+
+////////////////////////////////////////////////////////////////////////////////
+
+template <std::size_t N>
+[[nodiscard]] constexpr std::array<std::uint64_t, N / 64 + 1>
+createConstexprSieve() {
+  std::array<std::uint64_t, N / 64 + 1> bits{};
+  for (std::size_t i = 2; i <= N; ++i) {
+    bits[i / 64] |= 1ULL << (i % 64);
+  }
+  for (std::size_t i = 2; i * i <= N; ++i) {
+    if (((bits[i / 64] >> (i % 64)) & 1ULL) != 0) {
+      for (std::size_t j = i * i; j <= N; j += i) {
+        bits[j / 64] &= ~(1ULL << (j % 64));
+      }
+    }
+  }
+  return bits;
+}
+
+inline constexpr std::array<std::uint64_t, ConstexprSieveLimit / 64 + 1>
+    ConstexprSieveTable = createConstexprSieve<ConstexprSieveLimit>();
+
+[[nodiscard]] constexpr bool isSmallPrime(const std::uint64_t& x) {
+  if (x > ConstexprSieveLimit) {
+    throw std::out_of_range("Number exceeds the sieve limit");
+  }
+  return ((ConstexprSieveTable[x / 64] >> (x % 64)) & 1ULL) != 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace NAds::NAlgo::NSieve
@@ -1,6 +1,8 @@
 #include "sieve.hpp"
+#include "presieve.hpp"
 
 #include <stdexcept>
+#include <bit>
 
 namespace NAds::NAlgo::NSieve {
 
@@ -10,15 +12,27 @@ namespace NAds::NAlgo::NSieve {
   if (n == 0ULL) {
     throw std::range_error("Argument must be greater than zero");
   }
-  std::vector<bool> is_prime(n + 1, true);
-  is_prime[0] = is_prime[1] = false;
-  for (std::size_t i = 2; i * i <= n; ++i) {
-    if (is_prime[i]) {
-      for (std::size_t j = i * i; j <= n; j += i) {
-        is_prime[j] = false;
+  // Sieving is done on 64-bit words, only primes are written to the result
+  std::vector<std::uint64_t> bits(n / 64 + 1);
+  presieve(0, bits);
+  for (std::size_t i = PresievePrimes.back() + 2; i * i <= n; i += 2) {
+    if (((bits[i / 64] >> (i % 64)) & 1ULL) != 0) {
+      for (std::size_t j = i * i; j <= n; j += 2 * i) {
+        bits[j / 64] &= ~(1ULL << (j % 64));
       }
     }
   }
+  std::vector<bool> is_prime(n + 1, false);
+  for (std::size_t i = 0; i < bits.size(); ++i) {
+    for (std::uint64_t word = bits[i]; word != 0; word &= word - 1) {
+      const std::size_t x =
+          i * 64 + static_cast<std::size_t>(std::countr_zero(word));
+      if (x > n) {
+        break;
+      }
+      is_prime[x] = true;
+    }
+  }
   return is_prime;
 }
 
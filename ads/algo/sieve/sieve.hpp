@@ -1,6 +1,8 @@
 #pragma once
 
 #include <vector>
+#include <array>
+#include <cstdint>
 
 namespace NAds::NAlgo::NSieve {
 
@@ -10,4 +12,23 @@ namespace NAds::NAlgo::NSieve {
 
 ////////////////////////////////////////////////////////////////////////////////
 
-}  // namespace NAds::NAlgo::NSieve
\ No newline at end of file
+// Sieve of Eratosthenes over [0, N] evaluated at compile time. Bit x % 64 of
+// word x / 64 is set iff x is prime.
+template <std::size_t N>
+[[nodiscard]] constexpr std::array<std::uint64_t, N / 64 + 1>
+createConstexprSieve();
+
+// Values up to this bound are looked up in a table built at compile time
+inline constexpr std::uint64_t ConstexprSieveLimit = 65535;
+
+// A single load from .rodata. Throws std::out_of_range if x exceeds
+// ConstexprSieveLimit, for greater x use NPrimality::isPrime
+[[nodiscard]] constexpr bool isSmallPrime(const std::uint64_t& x);
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace NAds::NAlgo::NSieve
+
+#define ADS_ALGO_SIEVE_SIEVE_INL_HPP_
+#include "sieve-inl.hpp"
+#undef ADS_ALGO_SIEVE_SIEVE_INL_HPP_
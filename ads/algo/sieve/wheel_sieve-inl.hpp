@@ -0,0 +1,39 @@
+#ifndef ADS_ALGO_SIEVE_WHEEL_SIEVE_INL_HPP_
+#error "Direct inclusion of this file is not allowed, include wheel_sieve.hpp"
+// For the sake of sane code completion.
+#include "wheel_sieve.hpp"
+#endif
+
+#include <bit>
+#include <utility>
+
+namespace NAds::NAlgo::NSieve {
+
+////////////////////////////////////////////////////////////////////////////////
+
+template <typename TCallback>
+void TWheelSieveView::forEachPrime(TCallback&& callback) const {
+  for (const std::uint64_t& prime : WheelPrimes) {
+    if (prime <= N_) {
+      callback(prime);
+    }
+  }
+  const std::size_t bytes_count = Bits_.size();
+  for (std::size_t i = 0; i < bytes_count; ++i) {
+    auto byte = static_cast<unsigned int>(Bits_[i]);
+    while (byte != 0) {
+      const int bit = std::countr_zero(byte);
+      callback(i * WheelSize + Residues[static_cast<std::size_t>(bit)]);
+      byte &= byte - 1;
+    }
+  }
+}
+
+template <typename TCallback>
+void TWheelSieve::forEachPrime(TCallback&& callback) const {
+  view().forEachPrime(std::forward<TCallback>(callback));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace NAds::NAlgo::NSieve
@@ -0,0 +1,168 @@
+#include "wheel_sieve.hpp"
+
+#include <stdexcept>
+#include <bit>
+
+namespace NAds::NAlgo::NSieve {
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+
+constexpr std::uint64_t WheelSize = TWheelSieveView::WheelSize;
+constexpr std::array<std::uint8_t, 8> Residues = TWheelSieveView::Residues;
+
+constexpr std::uint8_t NoBit = 0xFF;
+
+// Bit index of a residue modulo 30, NoBit if residue is not coprime to 30
+constexpr std::array<std::uint8_t, 30> ResidueBit = {
+    NoBit, 0,     NoBit, NoBit, NoBit, NoBit, NoBit, 1,     NoBit, NoBit,
+    NoBit, 2,     NoBit, 3,     NoBit, NoBit, NoBit, 4,     NoBit, 5,
+    NoBit, NoBit, NoBit, 6,     NoBit, NoBit, NoBit, NoBit, NoBit, 7};
+
+// Distance from i-th residue to the next one: 1, 7, 11, 13, 17, 19, 23, 29, 31
+constexpr std::array<std::uint8_t, 8> ResidueGaps = {6, 4, 2, 4, 2, 4, 6, 2};
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+TWheelSieveView::TWheelSieveView(const std::uint64_t& n,
+                                 std::span<const std::uint8_t> bits)
+    : N_(n),
+      Bits_(bits) {
+  if (n == 0ULL) {
+    throw std::range_error("Argument must be greater than zero");
+  }
+  if (bits.size() != n / WheelSize + 1) {
+    throw std::range_error("Table size does not match the limit");
+  }
+}
+
+[[nodiscard]] std::uint64_t TWheelSieveView::limit() const noexcept {
+  return N_;
+}
+
+[[nodiscard]] bool TWheelSieveView::isPrime(const std::uint64_t& x) const {
+  if (x > N_) {
+    throw std::out_of_range("Number exceeds the sieve limit");
+  }
+  const std::uint8_t bit = ResidueBit[x % WheelSize];
+  if (bit == NoBit) {
+    return x == 2 || x == 3 || x == 5;
+  }
+  return ((Bits_[x / WheelSize] >> bit) & 1U) != 0;
+}
+
+[[nodiscard]] std::uint64_t TWheelSieveView::count() const noexcept {
+  std::uint64_t result = 0;
+  for (const std::uint64_t& prime : WheelPrimes) {
+    if (prime <= N_) {
+      ++result;
+    }
+  }
+  for (const std::uint8_t& byte : Bits_) {
+    result += static_cast<std::uint64_t>(std::popcount(byte));
+  }
+  return result;
+}
+
+[[nodiscard]] std::vector<std::uint64_t> TWheelSieveView::primes() const {
+  std::vector<std::uint64_t> result;
+  forEachPrime(
+      [&result](const std::uint64_t& prime) { result.push_back(prime); });
+  return result;
+}
+
+[[nodiscard]] std::span<const std::uint8_t> TWheelSieveView::bits()
+    const noexcept {
+  return Bits_;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TWheelSieve::TWheelSieve(const std::uint64_t& n)
+    : N_(n),
+      Bits_(n / WheelSize + 1, 0xFF) {
+  if (n == 0ULL) {
+    throw std::range_error("Argument must be greater than zero");
+  }
+  // 1 is not prime
+  Bits_[0] &= static_cast<std::uint8_t>(~1U);
+  const std::size_t bytes_count = Bits_.size();
+  bool is_done = false;
+  for (std::size_t i = 0; !is_done && i < bytes_count; ++i) {
+    for (std::size_t j = 0; j < Residues.size(); ++j) {
+      const std::uint64_t prime = i * WheelSize + Residues[j];
+      if (prime * prime > n) {
+        is_done = true;
+        break;
+      }
+      if (((Bits_[i] >> j) & 1U) != 0) {
+        crossOff(prime, j);
+      }
+    }
+  }
+  // Residues of the last byte which exceed n
+  const std::size_t last_byte = bytes_count - 1;
+  for (std::size_t j = 0; j < Residues.size(); ++j) {
+    if (last_byte * WheelSize + Residues[j] > n) {
+      Bits_[last_byte] &= static_cast<std::uint8_t>(~(1U << j));
+    }
+  }
+}
+
+[[nodiscard]] TWheelSieveView TWheelSieve::view() const noexcept {
+  return TWheelSieveView(N_, Bits_);
+}
+
+[[nodiscard]] std::uint64_t TWheelSieve::limit() const noexcept {
+  return N_;
+}
+
+[[nodiscard]] bool TWheelSieve::isPrime(const std::uint64_t& x) const {
+  return view().isPrime(x);
+}
+
+[[nodiscard]] std::uint64_t TWheelSieve::count() const noexcept {
+  return view().count();
+}
+
+[[nodiscard]] std::vector<std::uint64_t> TWheelSieve::primes() const {
+  return view().primes();
+}
+
+[[nodiscard]] std::size_t TWheelSieve::memoryUsage() const noexcept {
+  return Bits_.size();
+}
+
+// Multiples of prime coprime to 30 are prime * q with q coprime to 30. Each
+// of the 8 residue classes of q gives multiples with the same bit which are
+// exactly prime bytes apart, so every class is a plain strided loop.
+void TWheelSieve::crossOff(const std::uint64_t& prime,
+                           const std::size_t& residue_ind) {
+  const std::size_t last_byte = Bits_.size() - 1;
+  std::uint64_t factor = prime;
+  for (std::size_t j = 0; j < Residues.size(); ++j) {
+    const std::uint64_t multiple = prime * factor;
+    if (multiple > N_) {
+      // Greater factors of the same cycle give greater multiples
+      break;
+    }
+    const auto mask = static_cast<std::uint8_t>(
+        ~(1U << ResidueBit[multiple % WheelSize]));
+    for (std::size_t byte = multiple / WheelSize; byte <= last_byte;
+         byte += prime) {
+      Bits_[byte] &= mask;
+    }
+    factor += ResidueGaps[(residue_ind + j) % Residues.size()];
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace NAds::NAlgo::NSieve
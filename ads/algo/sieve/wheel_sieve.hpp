@@ -0,0 +1,83 @@
+#pragma once
+
+#include <vector>
+#include <array>
+#include <span>
+#include <cstdint>
+
+namespace NAds::NAlgo::NSieve {
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Read-only view over a mod 30 wheel table of [0, n]. Multiples of 2, 3 and 5
+// are not stored: byte k keeps one bit per residue coprime to 30 in
+// [30k, 30k + 30), i.e. 8 bits per 30 integers.
+class TWheelSieveView {
+public:
+  static constexpr std::uint64_t WheelSize = 30;
+  static constexpr std::array<std::uint8_t, 8> Residues = {1,  7,  11, 13,
+                                                           17, 19, 23, 29};
+  static constexpr std::array<std::uint64_t, 3> WheelPrimes = {2, 3, 5};
+
+  // bits must contain n / 30 + 1 bytes
+  TWheelSieveView(const std::uint64_t& n, std::span<const std::uint8_t> bits);
+
+  [[nodiscard]] std::uint64_t limit() const noexcept;
+
+  [[nodiscard]] bool isPrime(const std::uint64_t& x) const;
+
+  // Number of primes in [0, n]
+  [[nodiscard]] std::uint64_t count() const noexcept;
+
+  // Calls callback(prime) for every prime in [0, n] in increasing order
+  template <typename TCallback>
+  void forEachPrime(TCallback&& callback) const;
+
+  [[nodiscard]] std::vector<std::uint64_t> primes() const;
+
+  [[nodiscard]] std::span<const std::uint8_t> bits() const noexcept;
+
+private:
+  std::uint64_t N_;
+  std::span<const std::uint8_t> Bits_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Sieve of Eratosthenes over [0, n] on a mod 30 wheel, see TWheelSieveView
+class TWheelSieve {
+public:
+  explicit TWheelSieve(const std::uint64_t& n);
+
+  [[nodiscard]] TWheelSieveView view() const noexcept;
+
+  [[nodiscard]] std::uint64_t limit() const noexcept;
+
+  [[nodiscard]] bool isPrime(const std::uint64_t& x) const;
+
+  // Number of primes in [0, n]
+  [[nodiscard]] std::uint64_t count() const noexcept;
+
+  // Calls callback(prime) for every prime in [0, n] in increasing order
+  template <typename TCallback>
+  void forEachPrime(TCallback&& callback) const;
+
+  [[nodiscard]] std::vector<std::uint64_t> primes() const;
+
+  // Size of the packed table in bytes
+  [[nodiscard]] std::size_t memoryUsage() const noexcept;
+
+private:
+  void crossOff(const std::uint64_t& prime, const std::size_t& residue_ind);
+
+  std::uint64_t N_;
+  std::vector<std::uint8_t> Bits_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace NAds::NAlgo::NSieve
+
+#define ADS_ALGO_SIEVE_WHEEL_SIEVE_INL_HPP_
+#include "wheel_sieve-inl.hpp"
+#undef ADS_ALGO_SIEVE_WHEEL_SIEVE_INL_HPP_
@@ -0,0 +1,147 @@
+#include "horspool.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+namespace NAds::NAlgo::NSubstrSearch {
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+
+constexpr std::size_t NoPosition = std::string_view::npos;
+
+// Compared chars allowed per scanned char before the automaton takes over
+constexpr std::size_t CompareBudget = 4;
+
+// Most windows differ from the pattern early, so a short prefix is compared
+// first and the rest of the pattern is paid for only by windows which pass it
+constexpr std::size_t ComparePrefix = 16;
+
+using TShift = std::array<std::size_t, 256>;
+
+[[nodiscard]] TShift createShift(const std::string& pattern) {
+  if (pattern.empty()) {
+    throw std::range_error("Pattern must not be empty");
+  }
+  const std::size_t pattern_size = pattern.size();
+  TShift shift;
+  shift.fill(pattern_size);
+  for (std::size_t i = 0; i + 1 < pattern_size; ++i) {
+    shift[static_cast<unsigned char>(pattern[i])] = pattern_size - 1 - i;
+  }
+  return shift;
+}
+
+// The last char of the window is equal to that of the pattern. Adds the
+// number of compared chars to spent, matches included
+[[nodiscard]] bool matchWindow(const char* window, std::string_view pattern,
+                               std::size_t& spent) {
+  const std::size_t size = pattern.size() - 1;
+  const std::size_t prefix_size = std::min(size, ComparePrefix);
+  if (std::memcmp(window, pattern.data(), prefix_size) != 0) {
+    spent += prefix_size;
+    return false;
+  }
+  spent += size;
+  return std::memcmp(window + prefix_size, pattern.data() + prefix_size,
+                     size - prefix_size) == 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+THorspoolSearcher::THorspoolSearcher(std::string pattern)
+    : Kmp_(std::move(pattern)),
+      Shift_(createShift(Kmp_.pattern())) {
+}
+
+[[nodiscard]] const std::string& THorspoolSearcher::pattern() const noexcept {
+  return Kmp_.pattern();
+}
+
+// Calls callback(pos) for occurrences in order while it returns true.
+// Returns the position from which the text is left to the automaton, or
+// NoPosition if the whole text is done or the callback stopped the search
+template <typename TCallback>
+[[nodiscard]] std::size_t THorspoolSearcher::search(
+    std::string_view text, TCallback&& callback) const {
+  const std::string& pattern = Kmp_.pattern();
+  const std::size_t pattern_size = pattern.size();
+  if (text.size() < pattern_size) {
+    return NoPosition;
+  }
+  const std::size_t last_start = text.size() - pattern_size;
+  const char last = pattern.back();
+  std::size_t spent = 0;
+  for (std::size_t pos = 0; pos <= last_start;) {
+    const char window_last = text[pos + pattern_size - 1];
+    if (window_last == last) {
+      if (matchWindow(text.data() + pos, pattern, spent) && !callback(pos)) {
+        return NoPosition;
+      }
+      // All starts up to pos are checked
+      if (spent > CompareBudget * (pos + pattern_size)) {
+        return pos + 1;
+      }
+    }
+    pos += Shift_[static_cast<unsigned char>(window_last)];
+  }
+  return NoPosition;
+}
+
+[[nodiscard]] std::vector<std::size_t> THorspoolSearcher::findAll(
+    std::string_view text) const {
+  std::vector<std::size_t> occurrences;
+  const std::size_t rest = search(text, [&occurrences](std::size_t pos) {
+    occurrences.push_back(pos);
+    return true;
+  });
+  if (rest != NoPosition) {
+    const std::size_t pattern_size = pattern().size();
+    Kmp_.scan(text.substr(rest), 0,
+              [&occurrences, rest, pattern_size](std::size_t end) {
+                occurrences.push_back(rest + end - pattern_size);
+              });
+  }
+  return occurrences;
+}
+
+[[nodiscard]] std::size_t THorspoolSearcher::findFirst(
+    std::string_view text) const noexcept {
+  std::size_t first = NoPosition;
+  const std::size_t rest = search(text, [&first](std::size_t pos) {
+    first = pos;
+    return false;
+  });
+  if (rest != NoPosition) {
+    const std::size_t pos = Kmp_.findFirst(text.substr(rest));
+    return pos == NoPosition ? NoPosition : rest + pos;
+  }
+  return first;
+}
+
+[[nodiscard]] std::size_t THorspoolSearcher::count(
+    std::string_view text) const noexcept {
+  std::size_t occurrences_count = 0;
+  const std::size_t rest =
+      search(text, [&occurrences_count](std::size_t) {
+        ++occurrences_count;
+        return true;
+      });
+  if (rest != NoPosition) {
+    occurrences_count += Kmp_.count(text.substr(rest));
+  }
+  return occurrences_count;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace NAds::NAlgo::NSubstrSearch
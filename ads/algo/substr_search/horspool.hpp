@@ -0,0 +1,49 @@
+#pragma once
+
+#include "algo/kmp/kmp.hpp"
+
+#include <array>
+#include <vector>
+#include <string>
+#include <string_view>
+
+namespace NAds::NAlgo::NSubstrSearch {
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Boyer-Moore-Horspool search. The window is compared with the pattern and
+// shifted by the distance from the last occurrence of its last char in the
+// pattern (without the last position) to the pattern end, so on large
+// alphabets most shifts are close to |pattern| and the search is sublinear.
+// Windows which compare many chars, e.g. a^k b a^k in a^n, would make it
+// O(|text| * |pattern|), so if compared chars cost more than a few times the
+// scanned length, the rest of the text is left to the KMP automaton and the
+// worst case stays linear.
+class THorspoolSearcher {
+public:
+  // Throws std::range_error for an empty pattern
+  explicit THorspoolSearcher(std::string pattern);
+
+  [[nodiscard]] const std::string& pattern() const noexcept;
+
+  // Start positions of all occurrences, overlapping ones included
+  [[nodiscard]] std::vector<std::size_t> findAll(std::string_view text) const;
+
+  // Start position of the first occurrence, std::string_view::npos if none
+  [[nodiscard]] std::size_t findFirst(std::string_view text) const noexcept;
+
+  [[nodiscard]] std::size_t count(std::string_view text) const noexcept;
+
+private:
+  template <typename TCallback>
+  [[nodiscard]] std::size_t search(std::string_view text,
+                                   TCallback&& callback) const;
+
+  NKmp::TKmpMatcher Kmp_;
+  // Window shift by the last char of the window
+  std::array<std::size_t, 256> Shift_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace NAds::NAlgo::NSubstrSearch
@@ -0,0 +1,123 @@
+#include "parallel_search.hpp"
+
+#include <algorithm>
+#include <string>
+#include <utility>
+
+namespace NAds::NAlgo::NSubstrSearch {
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Each chunk has at least MinChunkSize start positions, so that thread
+// handoff and the overlap are negligible, and there are about
+// ChunksPerThread chunks per thread to balance the load
+constexpr std::size_t MinChunkSize = 1ULL << 20;
+constexpr std::size_t ChunksPerThread = 8;
+
+struct TChunks {
+  std::size_t StartsCount;
+  std::size_t ChunkSize;
+  std::size_t ChunksCount;
+};
+
+// Start positions of occurrences are split, a text shorter than the pattern
+// has no chunks
+[[nodiscard]] TChunks splitIntoChunks(const std::size_t& text_size,
+                                      const std::size_t& pattern_size,
+                                      const std::size_t& thread_count) {
+  const std::size_t starts_count =
+      text_size < pattern_size ? 0 : text_size - pattern_size + 1;
+  const std::size_t balanced_chunk_size =
+      starts_count / (std::max<std::size_t>(thread_count, 1) * ChunksPerThread);
+  const std::size_t chunk_size = std::max(MinChunkSize, balanced_chunk_size);
+  return TChunks{.StartsCount = starts_count,
+                 .ChunkSize = chunk_size,
+                 .ChunksCount = (starts_count + chunk_size - 1) / chunk_size};
+}
+
+// Calls task(chunk_ind, chunk_begin, chunk_text) for every chunk in parallel.
+// chunk_text holds the starts of the chunk and the tail of the last
+// occurrence starting in it
+template <typename TTask>
+void searchChunks(std::string_view text, const std::size_t& pattern_size,
+                  const std::size_t& thread_count, const TChunks& chunks,
+                  TTask&& task) {
+  NParallel::parallelFor(
+      chunks.ChunksCount, thread_count, [&](const std::size_t& chunk_ind) {
+        const std::size_t begin = chunk_ind * chunks.ChunkSize;
+        const std::size_t size =
+            std::min(chunks.ChunkSize, chunks.StartsCount - begin);
+        task(chunk_ind, begin, text.substr(begin, size + pattern_size - 1));
+      });
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+[[nodiscard]] std::vector<std::size_t> parallelFindAll(
+    const TSimdSearcher& searcher, std::string_view text,
+    const std::size_t& thread_count) {
+  const std::size_t pattern_size = searcher.pattern().size();
+  const TChunks chunks =
+      splitIntoChunks(text.size(), pattern_size, thread_count);
+  std::vector<std::vector<std::size_t>> chunk_occurrences(chunks.ChunksCount);
+  searchChunks(text, pattern_size, thread_count, chunks,
+               [&searcher, &chunk_occurrences](const std::size_t& chunk_ind,
+                                               const std::size_t& begin,
+                                               std::string_view chunk_text) {
+                 std::vector<std::size_t> occurrences =
+                     searcher.findAll(chunk_text);
+                 for (std::size_t& pos : occurrences) {
+                   pos += begin;
+                 }
+                 chunk_occurrences[chunk_ind] = std::move(occurrences);
+               });
+  std::size_t total_size = 0;
+  for (const std::vector<std::size_t>& occurrences : chunk_occurrences) {
+    total_size += occurrences.size();
+  }
+  std::vector<std::size_t> merged;
+  merged.reserve(total_size);
+  for (const std::vector<std::size_t>& occurrences : chunk_occurrences) {
+    merged.insert(merged.end(), occurrences.begin(), occurrences.end());
+  }
+  return merged;
+}
+
+[[nodiscard]] std::size_t parallelCount(const TSimdSearcher& searcher,
+                                        std::string_view text,
+                                        const std::size_t& thread_count) {
+  const std::size_t pattern_size = searcher.pattern().size();
+  const TChunks chunks =
+      splitIntoChunks(text.size(), pattern_size, thread_count);
+  std::vector<std::size_t> chunk_counts(chunks.ChunksCount, 0);
+  searchChunks(text, pattern_size, thread_count, chunks,
+               [&searcher, &chunk_counts](const std::size_t& chunk_ind,
+                                          const std::size_t&,
+                                          std::string_view chunk_text) {
+                 chunk_counts[chunk_ind] = searcher.count(chunk_text);
+               });
+  std::size_t count = 0;
+  for (const std::size_t& chunk_count : chunk_counts) {
+    count += chunk_count;
+  }
+  return count;
+}
+
+[[nodiscard]] std::vector<std::size_t> parallelSubstrSearch(
+    std::string_view text, std::string_view substr,
+    const std::size_t& thread_count) {
+  return parallelFindAll(TSimdSearcher(std::string(substr)), text,
+                         thread_count);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace NAds::NAlgo::NSubstrSearch
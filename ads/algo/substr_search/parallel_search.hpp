@@ -0,0 +1,34 @@
+#pragma once
+
+#include "simd_search.hpp"
+#include "algo/parallel/parallel_for.hpp"
+
+#include <vector>
+#include <string_view>
+
+namespace NAds::NAlgo::NSubstrSearch {
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Start positions of the text are split into chunks, every chunk is searched
+// by one shared TSimdSearcher in its slice of the text extended by
+// |pattern| - 1 chars, so occurrences crossing chunk borders are found.
+// Chunks own disjoint start positions, their occurrences are concatenated in
+// increasing order without duplicates.
+
+[[nodiscard]] std::vector<std::size_t> parallelFindAll(
+    const TSimdSearcher& searcher, std::string_view text,
+    const std::size_t& thread_count = NParallel::defaultThreadCount());
+
+[[nodiscard]] std::size_t parallelCount(
+    const TSimdSearcher& searcher, std::string_view text,
+    const std::size_t& thread_count = NParallel::defaultThreadCount());
+
+// Throws std::range_error for an empty substr
+[[nodiscard]] std::vector<std::size_t> parallelSubstrSearch(
+    std::string_view text, std::string_view substr,
+    const std::size_t& thread_count = NParallel::defaultThreadCount());
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace NAds::NAlgo::NSubstrSearch
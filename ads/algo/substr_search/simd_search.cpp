@@ -0,0 +1,255 @@
+#include "simd_search.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define ADS_ALGO_SUBSTR_SEARCH_SIMD_SEARCH_AVX2
+#endif
+
+namespace NAds::NAlgo::NSubstrSearch {
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+
+constexpr std::size_t NoPosition = std::string_view::npos;
+
+// Compared bytes allowed per scanned byte before the automaton takes over
+constexpr std::size_t VerifyBudget = 4;
+
+// Most candidates differ from the pattern early, so the middle of the pattern
+// is compared by a short prefix first and the rest is paid for only by
+// candidates which pass it
+constexpr std::size_t VerifyPrefix = 16;
+
+// Result of a candidate scan: a match at Pos, or Pos is where the budget ran
+// out and all earlier starts are checked, or Pos is NoPosition at the end
+struct TFound {
+  std::size_t Pos;
+  bool IsMatch;
+};
+
+// First and last chars of the candidate are equal to those of the pattern.
+// Adds the number of compared bytes to spent, matches included, so a text
+// full of occurrences of a long periodic pattern exhausts the budget too
+[[nodiscard]] bool verify(const char* candidate, std::string_view pattern,
+                          std::size_t& spent) {
+  const std::size_t middle_size = pattern.size() - 2;
+  const std::size_t prefix_size = std::min(middle_size, VerifyPrefix);
+  if (std::memcmp(candidate + 1, pattern.data() + 1, prefix_size) != 0) {
+    spent += prefix_size;
+    return false;
+  }
+  if (std::memcmp(candidate + 1 + prefix_size,
+                  pattern.data() + 1 + prefix_size,
+                  middle_size - prefix_size) != 0) {
+    spent += middle_size;
+    return false;
+  }
+  spent += middle_size;
+  return true;
+}
+
+[[nodiscard]] bool isExhausted(std::size_t spent, std::size_t pos,
+                               std::size_t pattern_size) {
+  return spent > VerifyBudget * (pos + pattern_size);
+}
+
+// Both kernels take a pattern of at least 2 chars and a text not shorter
+// than the pattern
+TFound findScalar(std::string_view text, std::string_view pattern,
+                  std::size_t from, std::size_t& spent) {
+  const std::size_t pattern_size = pattern.size();
+  const std::size_t end = text.size() - pattern_size + 1;
+  const char last = pattern.back();
+  while (from < end) {
+    const void* found =
+        std::memchr(text.data() + from, pattern.front(), end - from);
+    if (found == nullptr) {
+      break;
+    }
+    const auto pos =
+        static_cast<std::size_t>(static_cast<const char*>(found) - text.data());
+    if (text[pos + pattern_size - 1] == last) {
+      if (verify(text.data() + pos, pattern, spent)) {
+        return TFound{.Pos = pos, .IsMatch = true};
+      }
+      if (isExhausted(spent, pos, pattern_size)) {
+        return TFound{.Pos = pos + 1, .IsMatch = false};
+      }
+    }
+    from = pos + 1;
+  }
+  return TFound{.Pos = NoPosition, .IsMatch = false};
+}
+
+#ifdef ADS_ALGO_SUBSTR_SEARCH_SIMD_SEARCH_AVX2
+__attribute__((target("avx2"))) TFound findAvx2(std::string_view text,
+                                                std::string_view pattern,
+                                                std::size_t from,
+                                                std::size_t& spent) {
+  const std::size_t pattern_size = pattern.size();
+  const std::size_t end = text.size() - pattern_size + 1;
+  const __m256i first = _mm256_set1_epi8(pattern.front());
+  const __m256i last = _mm256_set1_epi8(pattern.back());
+  // Blocks of 32 starts, the last chars of their candidates are loaded from
+  // the block shifted by pattern_size - 1
+  for (; from + 32 <= end; from += 32) {
+    const __m256i block_first = _mm256_loadu_si256(
+        reinterpret_cast<const __m256i*>(text.data() + from));
+    const __m256i block_last = _mm256_loadu_si256(
+        reinterpret_cast<const __m256i*>(text.data() + from + pattern_size -
+                                         1));
+    auto candidates = static_cast<std::uint32_t>(
+        _mm256_movemask_epi8(_mm256_and_si256(
+            _mm256_cmpeq_epi8(first, block_first),
+            _mm256_cmpeq_epi8(last, block_last))));
+    while (candidates != 0) {
+      const std::size_t pos =
+          from + static_cast<std::size_t>(std::countr_zero(candidates));
+      if (verify(text.data() + pos, pattern, spent)) {
+        return TFound{.Pos = pos, .IsMatch = true};
+      }
+      if (isExhausted(spent, pos, pattern_size)) {
+        return TFound{.Pos = pos + 1, .IsMatch = false};
+      }
+      candidates &= candidates - 1;
+    }
+  }
+  // Less than a block of starts is left
+  return findScalar(text, pattern, from, spent);
+}
+#endif
+
+using TFind = TFound (*)(std::string_view, std::string_view, std::size_t,
+                         std::size_t&);
+
+[[nodiscard]] TFind selectFind() {
+#ifdef ADS_ALGO_SUBSTR_SEARCH_SIMD_SEARCH_AVX2
+  if (__builtin_cpu_supports("avx2")) {
+    return findAvx2;
+  }
+#endif
+  return findScalar;
+}
+
+// Calls callback(pos) for occurrences in order while it returns true.
+// Returns the position from which the text is left to the automaton, or
+// NoPosition if the whole text is done or the callback stopped the search
+template <typename TCallback>
+std::size_t prefilter(std::string_view text, std::string_view pattern,
+                      TCallback&& callback) {
+  static const TFind find = selectFind();
+  if (text.size() < pattern.size()) {
+    return NoPosition;
+  }
+  if (pattern.size() == 1) {
+    for (std::size_t from = 0; from < text.size();) {
+      const void* found =
+          std::memchr(text.data() + from, pattern.front(), text.size() - from);
+      if (found == nullptr) {
+        break;
+      }
+      const auto pos = static_cast<std::size_t>(
+          static_cast<const char*>(found) - text.data());
+      if (!callback(pos)) {
+        break;
+      }
+      from = pos + 1;
+    }
+    return NoPosition;
+  }
+  std::size_t spent = 0;
+  for (std::size_t from = 0;;) {
+    const TFound found = find(text, pattern, from, spent);
+    if (!found.IsMatch) {
+      return found.Pos;
+    }
+    if (!callback(found.Pos)) {
+      return NoPosition;
+    }
+    if (isExhausted(spent, found.Pos, pattern.size())) {
+      return found.Pos + 1;
+    }
+    from = found.Pos + 1;
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+TSimdSearcher::TSimdSearcher(std::string pattern)
+    : Kmp_(std::move(pattern)) {
+}
+
+[[nodiscard]] const std::string& TSimdSearcher::pattern() const noexcept {
+  return Kmp_.pattern();
+}
+
+[[nodiscard]] std::vector<std::size_t> TSimdSearcher::findAll(
+    std::string_view text) const {
+  std::vector<std::size_t> occurrences;
+  const std::size_t rest =
+      prefilter(text, pattern(), [&occurrences](std::size_t pos) {
+        occurrences.push_back(pos);
+        return true;
+      });
+  if (rest != NoPosition) {
+    const std::size_t pattern_size = pattern().size();
+    Kmp_.scan(text.substr(rest), 0,
+              [&occurrences, rest, pattern_size](std::size_t end) {
+                occurrences.push_back(rest + end - pattern_size);
+              });
+  }
+  return occurrences;
+}
+
+[[nodiscard]] std::size_t TSimdSearcher::findFirst(
+    std::string_view text) const noexcept {
+  std::size_t first = NoPosition;
+  const std::size_t rest =
+      prefilter(text, pattern(), [&first](std::size_t pos) {
+        first = pos;
+        return false;
+      });
+  if (rest != NoPosition) {
+    const std::size_t pos = Kmp_.findFirst(text.substr(rest));
+    return pos == NoPosition ? NoPosition : rest + pos;
+  }
+  return first;
+}
+
+[[nodiscard]] std::size_t TSimdSearcher::count(
+    std::string_view text) const noexcept {
+  std::size_t occurrences_count = 0;
+  const std::size_t rest =
+      prefilter(text, pattern(), [&occurrences_count](std::size_t) {
+        ++occurrences_count;
+        return true;
+      });
+  if (rest != NoPosition) {
+    occurrences_count += Kmp_.count(text.substr(rest));
+  }
+  return occurrences_count;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+[[nodiscard]] bool hasVectorFilter() noexcept {
+  static const bool has_vector_filter = selectFind() != findScalar;
+  return has_vector_filter;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace NAds::NAlgo::NSubstrSearch
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "algo/kmp/kmp.hpp"
+
+#include <vector>
+#include <string>
+#include <string_view>
+
+namespace NAds::NAlgo::NSubstrSearch {
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Single-pattern search with a SIMD candidate filter. Text positions whose
+// first and last chars equal those of the pattern are found 32 at a time with
+// AVX2 (memchr of the first char on other processors, chosen at runtime), and
+// only candidates are compared with the pattern. If failed comparisons cost
+// more than a few times the scanned length, the rest of the text is left to
+// the KMP automaton, so the worst case stays linear. All methods are const,
+// one searcher may be shared by threads.
+class TSimdSearcher {
+public:
+  // Throws std::range_error for an empty pattern
+  explicit TSimdSearcher(std::string pattern);
+
+  [[nodiscard]] const std::string& pattern() const noexcept;
+
+  // Start positions of all occurrences, overlapping ones included
+  [[nodiscard]] std::vector<std::size_t> findAll(std::string_view text) const;
+
+  // Start position of the first occurrence, std::string_view::npos if none
+  [[nodiscard]] std::size_t findFirst(std::string_view text) const noexcept;
+
+  [[nodiscard]] std::size_t count(std::string_view text) const noexcept;
+
+private:
+  NKmp::TKmpMatcher Kmp_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Whether candidates are filtered by vector comparisons on this processor,
+// otherwise TSimdSearcher finds them by memchr of the first char
+[[nodiscard]] bool hasVectorFilter() noexcept;
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace NAds::NAlgo::NSubstrSearch
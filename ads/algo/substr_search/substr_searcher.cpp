@@ -0,0 +1,127 @@
+#include "substr_searcher.hpp"
+
+#include <array>
+#include <stdexcept>
+#include <utility>
+
+namespace NAds::NAlgo::NSubstrSearch {
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Thresholds of the memchr path, see bench_substr_search
+constexpr std::size_t HorspoolMinPatternSize = 64;
+constexpr std::size_t SmallAlphabetSize = 4;
+
+[[nodiscard]] std::size_t distinctCharsCount(std::string_view pattern) {
+  std::array<bool, 256> is_seen{};
+  std::size_t distinct_count = 0;
+  for (const char c : pattern) {
+    bool& seen = is_seen[static_cast<unsigned char>(c)];
+    if (!seen) {
+      seen = true;
+      ++distinct_count;
+    }
+  }
+  return distinct_count;
+}
+
+// The smallest period p is the first shift with z[p] = |pattern| - p, the
+// pattern is periodic if it holds at least two periods
+[[nodiscard]] bool isPeriodic(std::string_view pattern) {
+  const std::vector<std::size_t> z_func = zFunction(pattern);
+  const std::size_t pattern_size = pattern.size();
+  for (std::size_t period = 1; 2 * period <= pattern_size; ++period) {
+    if (period + z_func[period] == pattern_size) {
+      return true;
+    }
+  }
+  return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+[[nodiscard]] ESearchEngine selectEngine(std::string_view pattern,
+                                         bool has_vector_filter) {
+  if (has_vector_filter) {
+    return ESearchEngine::Simd;
+  }
+  if (pattern.size() >= HorspoolMinPatternSize ||
+      distinctCharsCount(pattern) <= SmallAlphabetSize) {
+    return isPeriodic(pattern) ? ESearchEngine::TwoWay
+                               : ESearchEngine::Horspool;
+  }
+  return ESearchEngine::Simd;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TSubstrSearcher::TSubstrSearcher(std::string pattern)
+    : Engine_(createEngine(pattern, selectEngine(pattern))) {
+}
+
+TSubstrSearcher::TSubstrSearcher(std::string pattern, ESearchEngine engine)
+    : Engine_(createEngine(std::move(pattern), engine)) {
+}
+
+[[nodiscard]] ESearchEngine TSubstrSearcher::engine() const noexcept {
+  return static_cast<ESearchEngine>(Engine_.index());
+}
+
+[[nodiscard]] const std::string& TSubstrSearcher::pattern() const noexcept {
+  return std::visit(
+      [](const auto& engine) -> const std::string& { return engine.pattern(); },
+      Engine_);
+}
+
+[[nodiscard]] std::vector<std::size_t> TSubstrSearcher::findAll(
+    std::string_view text) const {
+  return std::visit([text](const auto& engine) { return engine.findAll(text); },
+                    Engine_);
+}
+
+[[nodiscard]] std::size_t TSubstrSearcher::findFirst(
+    std::string_view text) const noexcept {
+  return std::visit(
+      [text](const auto& engine) { return engine.findFirst(text); }, Engine_);
+}
+
+[[nodiscard]] std::size_t TSubstrSearcher::count(
+    std::string_view text) const noexcept {
+  return std::visit([text](const auto& engine) { return engine.count(text); },
+                    Engine_);
+}
+
+[[nodiscard]] TSubstrSearcher::TEngine TSubstrSearcher::createEngine(
+    std::string pattern, ESearchEngine engine) {
+  switch (engine) {
+    case ESearchEngine::Simd:
+      return TEngine(std::in_place_type<TSimdSearcher>, std::move(pattern));
+    case ESearchEngine::Horspool:
+      return TEngine(std::in_place_type<THorspoolSearcher>,
+                     std::move(pattern));
+    case ESearchEngine::TwoWay:
+      return TEngine(std::in_place_type<TTwoWaySearcher>, std::move(pattern));
+    case ESearchEngine::ZFunction:
+      return TEngine(std::in_place_type<TZSearcher>, std::move(pattern));
+  }
+  throw std::range_error("Unknown search engine");
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+[[nodiscard]] std::vector<std::size_t> substrSearch(std::string_view text,
+                                                    std::string_view substr) {
+  return TSubstrSearcher(std::string(substr)).findAll(text);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace NAds::NAlgo::NSubstrSearch
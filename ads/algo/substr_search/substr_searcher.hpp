@@ -0,0 +1,80 @@
+#pragma once
+
+#include "simd_search.hpp"
+#include "horspool.hpp"
+#include "two_way.hpp"
+#include "z_function.hpp"
+
+#include <variant>
+#include <vector>
+#include <string>
+#include <string_view>
+
+namespace NAds::NAlgo::NSubstrSearch {
+
+////////////////////////////////////////////////////////////////////////////////
+
+enum class ESearchEngine {
+  Simd,
+  Horspool,
+  TwoWay,
+  ZFunction,
+};
+
+// Engine for a pattern searched in many texts on a processor with or without
+// the vector filter of TSimdSearcher (see hasVectorFilter):
+// - Simd with the vector filter, it is the fastest on every corpus of the
+//   benchmark matrix and its verification budget keeps periodic patterns
+//   linear
+// - otherwise Horspool for patterns of at least 64 chars or of at most 4
+//   distinct chars, where memchr of the first char stops too often, and
+//   Simd for the rest
+// - TwoWay instead of Horspool for periodic patterns, on which Horspool soon
+//   spends its comparison budget and leaves the text to the KMP automaton
+[[nodiscard]] ESearchEngine selectEngine(
+    std::string_view pattern, bool has_vector_filter = hasVectorFilter());
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Single-pattern search by one of the engines, chosen by selectEngine or
+// given explicitly. Methods are const, one searcher may be shared by threads.
+class TSubstrSearcher {
+public:
+  // Throws std::range_error for an empty pattern
+  explicit TSubstrSearcher(std::string pattern);
+
+  TSubstrSearcher(std::string pattern, ESearchEngine engine);
+
+  [[nodiscard]] ESearchEngine engine() const noexcept;
+
+  [[nodiscard]] const std::string& pattern() const noexcept;
+
+  // Start positions of all occurrences, overlapping ones included
+  [[nodiscard]] std::vector<std::size_t> findAll(std::string_view text) const;
+
+  // Start position of the first occurrence, std::string_view::npos if none
+  [[nodiscard]] std::size_t findFirst(std::string_view text) const noexcept;
+
+  [[nodiscard]] std::size_t count(std::string_view text) const noexcept;
+
+private:
+  // Alternatives are in the order of ESearchEngine
+  using TEngine = std::variant<TSimdSearcher, THorspoolSearcher,
+                               TTwoWaySearcher, TZSearcher>;
+
+  [[nodiscard]] static TEngine createEngine(std::string pattern,
+                                            ESearchEngine engine);
+
+  TEngine Engine_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Single search by the engine of selectEngine. Throws std::range_error for an
+// empty substr
+[[nodiscard]] std::vector<std::size_t> substrSearch(std::string_view text,
+                                                    std::string_view substr);
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace NAds::NAlgo::NSubstrSearch
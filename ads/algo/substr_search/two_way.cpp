@@ -0,0 +1,158 @@
+#include "two_way.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+namespace NAds::NAlgo::NSubstrSearch {
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+
+struct TMaxSuffix {
+  // Start of the maximal suffix
+  std::size_t Pos;
+  // Period of the maximal suffix
+  std::size_t Period;
+};
+
+// Maximal suffix of pattern in lexicographic order of chars, or in the
+// reversed order (Charras, Lecroq, Handbook of Exact String Matching)
+[[nodiscard]] TMaxSuffix maxSuffix(std::string_view pattern,
+                                   bool is_reversed) {
+  const std::size_t pattern_size = pattern.size();
+  std::size_t pos = 0;
+  std::size_t j = 0;
+  std::size_t k = 1;
+  std::size_t period = 1;
+  while (j + k < pattern_size) {
+    const auto a = static_cast<unsigned char>(pattern[j + k]);
+    const auto b = static_cast<unsigned char>(pattern[pos + k - 1]);
+    if (is_reversed ? a > b : a < b) {
+      j += k;
+      k = 1;
+      period = j + 1 - pos;
+    } else if (a == b) {
+      if (k != period) {
+        ++k;
+      } else {
+        j += period;
+        k = 1;
+      }
+    } else {
+      pos = j + 1;
+      j = pos;
+      k = 1;
+      period = 1;
+    }
+  }
+  return TMaxSuffix{.Pos = pos, .Period = period};
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+// The later of two maximal suffixes gives a critical factorization, and the
+// pattern is periodic iff u is a suffix of its first period
+TTwoWaySearcher::TTwoWaySearcher(std::string pattern)
+    : Pattern_(std::move(pattern)),
+      CriticalPos_(0),
+      Period_(0),
+      IsPeriodic_(false) {
+  if (Pattern_.empty()) {
+    throw std::range_error("Pattern must not be empty");
+  }
+  const std::size_t pattern_size = Pattern_.size();
+  const TMaxSuffix direct = maxSuffix(Pattern_, false);
+  const TMaxSuffix reversed = maxSuffix(Pattern_, true);
+  const TMaxSuffix& critical = direct.Pos > reversed.Pos ? direct : reversed;
+  CriticalPos_ = critical.Pos;
+  IsPeriodic_ =
+      critical.Pos + critical.Period <= pattern_size &&
+      std::memcmp(Pattern_.data(), Pattern_.data() + critical.Period,
+                  critical.Pos) == 0;
+  Period_ = IsPeriodic_
+                ? critical.Period
+                : std::max(CriticalPos_, pattern_size - CriticalPos_) + 1;
+}
+
+[[nodiscard]] const std::string& TTwoWaySearcher::pattern() const noexcept {
+  return Pattern_;
+}
+
+// Calls callback(pos) for occurrences in order while it returns true.
+// memory is the length of the pattern prefix known to match the window,
+// it is nonzero only for periodic patterns after a shift by the period
+template <typename TCallback>
+void TTwoWaySearcher::search(std::string_view text,
+                             TCallback&& callback) const {
+  const std::size_t pattern_size = Pattern_.size();
+  if (text.size() < pattern_size) {
+    return;
+  }
+  const std::size_t last_start = text.size() - pattern_size;
+  const char* pattern = Pattern_.data();
+  std::size_t memory = 0;
+  for (std::size_t pos = 0; pos <= last_start;) {
+    const char* window = text.data() + pos;
+    std::size_t i = std::max(CriticalPos_, memory);
+    while (i < pattern_size && pattern[i] == window[i]) {
+      ++i;
+    }
+    if (i < pattern_size) {
+      pos += i - CriticalPos_ + 1;
+      memory = 0;
+      continue;
+    }
+    std::size_t k = CriticalPos_;
+    while (k > memory && pattern[k - 1] == window[k - 1]) {
+      --k;
+    }
+    if (k <= memory && !callback(pos)) {
+      return;
+    }
+    pos += Period_;
+    memory = IsPeriodic_ ? pattern_size - Period_ : 0;
+  }
+}
+
+[[nodiscard]] std::vector<std::size_t> TTwoWaySearcher::findAll(
+    std::string_view text) const {
+  std::vector<std::size_t> occurrences;
+  search(text, [&occurrences](std::size_t pos) {
+    occurrences.push_back(pos);
+    return true;
+  });
+  return occurrences;
+}
+
+[[nodiscard]] std::size_t TTwoWaySearcher::findFirst(
+    std::string_view text) const noexcept {
+  std::size_t first = std::string_view::npos;
+  search(text, [&first](std::size_t pos) {
+    first = pos;
+    return false;
+  });
+  return first;
+}
+
+[[nodiscard]] std::size_t TTwoWaySearcher::count(
+    std::string_view text) const noexcept {
+  std::size_t occurrences_count = 0;
+  search(text, [&occurrences_count](std::size_t) {
+    ++occurrences_count;
+    return true;
+  });
+  return occurrences_count;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace NAds::NAlgo::NSubstrSearch
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <string_view>
+
+namespace NAds::NAlgo::NSubstrSearch {
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Crochemore-Perrin Two-Way search. The pattern is cut at a critical
+// factorization u v computed from maximal suffixes. A window compares v left
+// to right, then u right to left, and shifts by the period of the pattern
+// or past the mismatch. A periodic pattern remembers the prefix matched by
+// the previous window, so the search is linear in the worst case with O(1)
+// additional memory and no alphabet-sized tables.
+class TTwoWaySearcher {
+public:
+  // Throws std::range_error for an empty pattern
+  explicit TTwoWaySearcher(std::string pattern);
+
+  [[nodiscard]] const std::string& pattern() const noexcept;
+
+  // Start positions of all occurrences, overlapping ones included
+  [[nodiscard]] std::vector<std::size_t> findAll(std::string_view text) const;
+
+  // Start position of the first occurrence, std::string_view::npos if none
+  [[nodiscard]] std::size_t findFirst(std::string_view text) const noexcept;
+
+  [[nodiscard]] std::size_t count(std::string_view text) const noexcept;
+
+private:
+  template <typename TCallback>
+  void search(std::string_view text, TCallback&& callback) const;
+
+  std::string Pattern_;
+  // Length of u
+  std::size_t CriticalPos_;
+  // Period of the pattern if IsPeriodic_, otherwise a shift after a match
+  // which is smaller than the period
+  std::size_t Period_;
+  bool IsPeriodic_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace NAds::NAlgo::NSubstrSearch
@@ -0,0 +1,106 @@
+#include "z_function.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+namespace NAds::NAlgo::NSubstrSearch {
+
+////////////////////////////////////////////////////////////////////////////////
+
+// [left, right) is the rightmost segment matching a prefix of s
+[[nodiscard]] std::vector<std::size_t> zFunction(std::string_view s) {
+  const std::size_t s_size = s.size();
+  std::vector<std::size_t> z_func(s_size, 0);
+  std::size_t left = 0;
+  std::size_t right = 0;
+  for (std::size_t i = 1; i < s_size; ++i) {
+    std::size_t len = i < right ? std::min(right - i, z_func[i - left]) : 0;
+    while (i + len < s_size && s[len] == s[i + len]) {
+      ++len;
+    }
+    if (i + len > right) {
+      left = i;
+      right = i + len;
+    }
+    z_func[i] = len;
+  }
+  return z_func;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+TZSearcher::TZSearcher(std::string pattern)
+    : Pattern_(std::move(pattern)),
+      ZFunc_(zFunction(Pattern_)) {
+  if (Pattern_.empty()) {
+    throw std::range_error("Pattern must not be empty");
+  }
+}
+
+[[nodiscard]] const std::string& TZSearcher::pattern() const noexcept {
+  return Pattern_;
+}
+
+// Calls callback(pos) for occurrences in order while it returns true.
+// [left, right) is the rightmost text segment matching a pattern prefix, for
+// i in it the common prefix is at least min(right - i, z[i - left]) and
+// exactly z[i - left] if that is smaller
+template <typename TCallback>
+void TZSearcher::search(std::string_view text, TCallback&& callback) const {
+  const std::size_t pattern_size = Pattern_.size();
+  const std::size_t text_size = text.size();
+  if (text_size < pattern_size) {
+    return;
+  }
+  const std::size_t last_start = text_size - pattern_size;
+  std::size_t left = 0;
+  std::size_t right = 0;
+  for (std::size_t i = 0; i <= last_start; ++i) {
+    std::size_t len = i < right ? std::min(right - i, ZFunc_[i - left]) : 0;
+    if (i + len >= right) {
+      while (len < pattern_size && Pattern_[len] == text[i + len]) {
+        ++len;
+      }
+      left = i;
+      right = i + len;
+    }
+    if (len == pattern_size && !callback(i)) {
+      return;
+    }
+  }
+}
+
+[[nodiscard]] std::vector<std::size_t> TZSearcher::findAll(
+    std::string_view text) const {
+  std::vector<std::size_t> occurrences;
+  search(text, [&occurrences](std::size_t pos) {
+    occurrences.push_back(pos);
+    return true;
+  });
+  return occurrences;
+}
+
+[[nodiscard]] std::size_t TZSearcher::findFirst(
+    std::string_view text) const noexcept {
+  std::size_t first = std::string_view::npos;
+  search(text, [&first](std::size_t pos) {
+    first = pos;
+    return false;
+  });
+  return first;
+}
+
+[[nodiscard]] std::size_t TZSearcher::count(
+    std::string_view text) const noexcept {
+  std::size_t occurrences_count = 0;
+  search(text, [&occurrences_count](std::size_t) {
+    ++occurrences_count;
+    return true;
+  });
+  return occurrences_count;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace NAds::NAlgo::NSubstrSearch
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include <string_view>
+
+namespace NAds::NAlgo::NSubstrSearch {
+
+////////////////////////////////////////////////////////////////////////////////
+
+// z[i] is the length of the longest common prefix of s and s[i, |s|),
+// z[0] = 0
+[[nodiscard]] std::vector<std::size_t> zFunction(std::string_view s);
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Search by the Z-function of the pattern. The longest common prefix of the
+// pattern and every text suffix is computed in one pass: inside the rightmost
+// text segment known to match a pattern prefix it is read off the Z-function,
+// so every text char is compared O(1) times on average and no separator char
+// is needed.
+class TZSearcher {
+public:
+  // Throws std::range_error for an empty pattern
+  explicit TZSearcher(std::string pattern);
+
+  [[nodiscard]] const std::string& pattern() const noexcept;
+
+  // Start positions of all occurrences, overlapping ones included
+  [[nodiscard]] std::vector<std::size_t> findAll(std::string_view text) const;
+
+  // Start position of the first occurrence, std::string_view::npos if none
+  [[nodiscard]] std::size_t findFirst(std::string_view text) const noexcept;
+
+  [[nodiscard]] std::size_t count(std::string_view text) const noexcept;
+
+private:
+  template <typename TCallback>
+  void search(std::string_view text, TCallback&& callback) const;
+
+  std::string Pattern_;
+  std::vector<std::size_t> ZFunc_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+}  // namespace NAds::NAlgo::NSubstrSearch
@@ -41,7 +41,24 @@ template <char AlphaLeft, char AlphaRight>
 requires(AlphaRight >= AlphaLeft)
 [[nodiscard]] TAhoCorasick<AlphaLeft, AlphaRight>::TOccurrences
 TAhoCorasick<AlphaLeft, AlphaRight>::findAllOccurrences(
-    const std::string& text) {
+    std::string_view text) {
+  return findOccurrences(std::span(text));
+}
+
+template <char AlphaLeft, char AlphaRight>
+requires(AlphaRight >= AlphaLeft)
+[[nodiscard]] TAhoCorasick<AlphaLeft, AlphaRight>::TOccurrences
+TAhoCorasick<AlphaLeft, AlphaRight>::findAllOccurrences(
+    std::span<const std::byte> text) {
+  return findOccurrences(text);
+}
+
+template <char AlphaLeft, char AlphaRight>
+requires(AlphaRight >= AlphaLeft)
+template <typename TSymbol>
+[[nodiscard]] TAhoCorasick<AlphaLeft, AlphaRight>::TOccurrences
+TAhoCorasick<AlphaLeft, AlphaRight>::findOccurrences(
+    std::span<const TSymbol> text) {
   if (!IsBuilt_) {
     buildAutomata();
     IsBuilt_ = true;
@@ -50,7 +67,7 @@ TAhoCorasick<AlphaLeft, AlphaRight>::findAllOccurrences(
   std::vector<TOccurrenceInfo> occurences;
   const std::size_t text_size = text.size();
   for (std::size_t i = 0; i < text_size; ++i) {
-    curr_node = Nodes_[curr_node].Next[text[i] - AlphaLeft];
+    curr_node = nextNode(curr_node, static_cast<char>(text[i]));
     std::size_t traverse_back_node = curr_node;
     do {
       if (Nodes_[traverse_back_node].IsTerminal) {
@@ -64,6 +81,16 @@ TAhoCorasick<AlphaLeft, AlphaRight>::findAllOccurrences(
   return occurences;
 }
 
+template <char AlphaLeft, char AlphaRight>
+requires(AlphaRight >= AlphaLeft)
+[[nodiscard]] std::size_t TAhoCorasick<AlphaLeft, AlphaRight>::nextNode(
+    std::size_t node, char symbol) const {
+  if (symbol < AlphaLeft || symbol > AlphaRight) {
+    return 0;
+  }
+  return Nodes_[node].Next[static_cast<std::size_t>(symbol - AlphaLeft)];
+}
+
 // This function must be called after all strings was added
 // Aho-Corasick algorithm implementation
 // Lecture: https://www.youtube.com/watch?v=V7S80KpbQpk&list=LL&index=5&t=2s
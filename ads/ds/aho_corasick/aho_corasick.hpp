@@ -1,7 +1,9 @@
 #pragma once
 
 #include <vector>
+#include <span>
 #include <string>
+#include <string_view>
 #include <cstdint>
 #include <limits>
 
@@ -23,8 +25,14 @@ public:
 
   void addString(const std::string& s);
 
-  // Return pairs[index of end position of string in text, string index]
-  [[nodiscard]] TOccurrences findAllOccurrences(const std::string& text);
+  // Return pairs[index of end position of string in text, string index].
+  // A char out of [AlphaLeft, AlphaRight] resets matching, no added string
+  // contains it
+  [[nodiscard]] TOccurrences findAllOccurrences(std::string_view text);
+
+  // Raw bytes, e.g. of a memory mapped file, are searched without a copy
+  [[nodiscard]] TOccurrences findAllOccurrences(
+      std::span<const std::byte> text);
 
 private:
   static constexpr std::int64_t AlphaSize =
@@ -38,6 +46,12 @@ private:
   // Lecture: https://www.youtube.com/watch?v=V7S80KpbQpk&list=LL&index=5&t=2s
   void buildAutomata();
 
+  template <typename TSymbol>
+  [[nodiscard]] TOccurrences findOccurrences(std::span<const TSymbol> text);
+
+  // Root for a symbol out of [AlphaLeft, AlphaRight]
+  [[nodiscard]] std::size_t nextNode(std::size_t node, char symbol) const;
+
   struct TNode {
     TNode();
 
@@ -0,0 +1,165 @@
+#include <benchmark/benchmark.h>
+
+#include "algo/euclidean/euclidean.hpp"
+#include "algo/euclidean/big_gcd.hpp"
+
+#include <limits>
+#include <random>
+#include <utility>
+#include <vector>
+
+using namespace NAds::NAlgo::NEuclidean;
+
+namespace {
+
+constexpr std::size_t PairsCount = 1024;
+
+using TPairs = std::vector<std::pair<std::uint64_t, std::uint64_t>>;
+
+// Uniform 64-bit operands
+TPairs randomPairs() {
+  std::mt19937_64 generator(42);
+  TPairs pairs;
+  for (std::size_t i = 0; i < PairsCount; ++i) {
+    pairs.emplace_back(generator(), generator());
+  }
+  return pairs;
+}
+
+// Consecutive Fibonacci numbers maximize the number of Euclid steps
+TPairs fibonacciPairs() {
+  std::vector<std::uint64_t> fibonacci = {1, 2};
+  const std::uint64_t max = std::numeric_limits<std::uint64_t>::max();
+  while (fibonacci.back() <= max - fibonacci[fibonacci.size() - 2]) {
+    fibonacci.push_back(fibonacci.back() + fibonacci[fibonacci.size() - 2]);
+  }
+  TPairs pairs;
+  for (std::size_t i = 0; i < PairsCount; ++i) {
+    const std::size_t ind = fibonacci.size() - 1 - i % 8;
+    pairs.emplace_back(fibonacci[ind], fibonacci[ind - 1]);
+  }
+  return pairs;
+}
+
+// Operands below 2^16, e.g. normalization of small fractions
+TPairs smallPairs() {
+  std::mt19937_64 generator(42);
+  TPairs pairs;
+  for (std::size_t i = 0; i < PairsCount; ++i) {
+    pairs.emplace_back(generator() % 65536 + 1, generator() % 65536 + 1);
+  }
+  return pairs;
+}
+
+template <EGcdAlgorithm Algorithm>
+void runGcd(benchmark::State& state, const TPairs& pairs) {
+  for (auto _ : state) {
+    std::uint64_t sum = 0;
+    for (const auto& [a, b] : pairs) {
+      sum += gcd<Algorithm>(a, b);
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<std::int64_t>(pairs.size()));
+}
+
+}  // namespace
+
+template <EGcdAlgorithm Algorithm>
+static void BM_GcdRandom(benchmark::State& state) {
+  runGcd<Algorithm>(state, randomPairs());
+}
+BENCHMARK(BM_GcdRandom<EGcdAlgorithm::Euclid>);
+BENCHMARK(BM_GcdRandom<EGcdAlgorithm::Binary>);
+
+template <EGcdAlgorithm Algorithm>
+static void BM_GcdFibonacci(benchmark::State& state) {
+  runGcd<Algorithm>(state, fibonacciPairs());
+}
+BENCHMARK(BM_GcdFibonacci<EGcdAlgorithm::Euclid>);
+BENCHMARK(BM_GcdFibonacci<EGcdAlgorithm::Binary>);
+
+template <EGcdAlgorithm Algorithm>
+static void BM_GcdSmall(benchmark::State& state) {
+  runGcd<Algorithm>(state, smallPairs());
+}
+BENCHMARK(BM_GcdSmall<EGcdAlgorithm::Euclid>);
+BENCHMARK(BM_GcdSmall<EGcdAlgorithm::Binary>);
+
+// Baseline for BM_GcdBatch is the scalar gcd loop over the same pairs
+template <bool IsBatch>
+static void BM_GcdBatch(benchmark::State& state) {
+  const TPairs pairs = randomPairs();
+  std::vector<std::uint64_t> a;
+  std::vector<std::uint64_t> b;
+  for (const auto& [first, second] : pairs) {
+    a.push_back(first);
+    b.push_back(second);
+  }
+  std::vector<std::uint64_t> out(pairs.size());
+  for (auto _ : state) {
+    if constexpr (IsBatch) {
+      gcdBatch(a, b, out);
+    } else {
+      for (std::size_t i = 0; i < pairs.size(); ++i) {
+        out[i] = gcd(a[i], b[i]);
+      }
+    }
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<std::int64_t>(pairs.size()));
+}
+BENCHMARK(BM_GcdBatch<false>);
+BENCHMARK(BM_GcdBatch<true>);
+
+// Baseline for BM_ModInverseBatch is modInverse of every value
+template <bool IsBatch>
+static void BM_ModInverseBatch(benchmark::State& state) {
+  const std::uint64_t modulus = 0xFFFF'FFFF'FFFF'FFC5ULL;  // 2^64 - 59, prime
+  std::mt19937_64 generator(42);
+  std::vector<std::uint64_t> values(PairsCount);
+  for (std::uint64_t& value : values) {
+    value = generator() % (modulus - 1) + 1;
+  }
+  std::vector<std::uint64_t> out(values.size());
+  for (auto _ : state) {
+    if constexpr (IsBatch) {
+      modInverseBatch(values, modulus, out);
+    } else {
+      for (std::size_t i = 0; i < values.size(); ++i) {
+        out[i] = modInverse(values[i], modulus);
+      }
+    }
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<std::int64_t>(values.size()));
+}
+BENCHMARK(BM_ModInverseBatch<false>);
+BENCHMARK(BM_ModInverseBatch<true>);
+
+// Multi-precision gcd of two random numbers of state.range(0) bits
+template <bool IsLehmer>
+static void BM_BigGcd(benchmark::State& state) {
+  const auto limbs_count = static_cast<std::size_t>(state.range(0) / 64);
+  std::mt19937_64 generator(42);
+  std::vector<std::uint64_t> a(limbs_count);
+  std::vector<std::uint64_t> b(limbs_count);
+  for (std::size_t i = 0; i < limbs_count; ++i) {
+    a[i] = generator();
+    b[i] = generator();
+  }
+  for (auto _ : state) {
+    if constexpr (IsLehmer) {
+      benchmark::DoNotOptimize(bigGcd(a, b));
+    } else {
+      benchmark::DoNotOptimize(bigGcdEuclid(a, b));
+    }
+  }
+}
+BENCHMARK(BM_BigGcd<false>)->Arg(1024)->Arg(4096)->Arg(8192);
+BENCHMARK(BM_BigGcd<true>)->Arg(1024)->Arg(4096)->Arg(8192);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,127 @@
+#include <benchmark/benchmark.h>
+
+#include "algo/kmp/kmp.hpp"
+
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace NAds::NAlgo::NKmp;
+
+namespace {
+
+constexpr std::size_t LinesCount = 10'000;
+
+// Log-like lines of 40-120 lowercase letters and spaces
+[[nodiscard]] std::vector<std::string> logLines() {
+  std::mt19937_64 generator(42);
+  std::vector<std::string> lines(LinesCount);
+  for (std::string& line : lines) {
+    line.resize(40 + generator() % 81);
+    for (char& c : line) {
+      const std::uint64_t value = generator() % 27;
+      c = value == 26 ? ' ' : static_cast<char>('a' + value);
+    }
+  }
+  return lines;
+}
+
+constexpr std::size_t PatternsCount = 5;
+
+// Random patterns of the same alphabet, mostly absent from the lines
+[[nodiscard]] std::vector<std::string> patterns(std::size_t pattern_size) {
+  std::mt19937_64 generator(43);
+  std::vector<std::string> result(PatternsCount);
+  for (std::string& pattern : result) {
+    pattern.resize(pattern_size);
+    for (char& c : pattern) {
+      c = static_cast<char>('a' + generator() % 26);
+    }
+  }
+  return result;
+}
+
+}  // namespace
+
+// Every line is searched for every pattern of state.range(0) chars.
+// kmpSubstrSearch compiles the pattern on every call, TKmpMatcher once
+template <bool IsCompiled>
+static void BM_KmpLines(benchmark::State& state) {
+  const std::vector<std::string> lines = logLines();
+  const std::vector<std::string> searched =
+      patterns(static_cast<std::size_t>(state.range(0)));
+  std::vector<TKmpMatcher> matchers;
+  for (const std::string& pattern : searched) {
+    matchers.emplace_back(pattern);
+  }
+  for (auto _ : state) {
+    std::size_t found = 0;
+    for (const std::string& line : lines) {
+      for (std::size_t i = 0; i < searched.size(); ++i) {
+        if constexpr (IsCompiled) {
+          found += matchers[i].count(line);
+        } else {
+          found += kmpSubstrSearch(line, searched[i]).size();
+        }
+      }
+    }
+    benchmark::DoNotOptimize(found);
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<std::int64_t>(lines.size()));
+}
+BENCHMARK(BM_KmpLines<false>)->Arg(4)->Arg(32)->Arg(256);
+BENCHMARK(BM_KmpLines<true>)->Arg(4)->Arg(32)->Arg(256);
+
+// 16 MiB text fed by chunks of state.range(0) bytes, the whole text at once
+// for state.range(0) = 0
+static void BM_KmpStream(benchmark::State& state) {
+  std::mt19937_64 generator(42);
+  std::string text(1ULL << 24, 'a');
+  for (char& c : text) {
+    c = static_cast<char>('a' + generator() % 4);
+  }
+  const TKmpMatcher matcher("abcdabca");
+  const auto chunk_size = static_cast<std::size_t>(state.range(0));
+  for (auto _ : state) {
+    std::uint64_t found = 0;
+    if (chunk_size == 0) {
+      found = matcher.count(text);
+    } else {
+      TKmpStreamMatcher stream(matcher);
+      const std::string_view view(text);
+      for (std::size_t begin = 0; begin < view.size(); begin += chunk_size) {
+        stream.feed(view.substr(begin, chunk_size),
+                    [&found](std::uint64_t) { ++found; });
+      }
+    }
+    benchmark::DoNotOptimize(found);
+  }
+  state.SetBytesProcessed(state.iterations() *
+                          static_cast<std::int64_t>(text.size()));
+}
+BENCHMARK(BM_KmpStream)->Arg(0)->Arg(1 << 16);
+
+// 16 MiB of random chars over an alphabet of state.range(0) letters searched
+// for a periodic pattern, small alphabets make the fallback loop of
+// TKmpMatcher long and unpredictable
+template <typename TMatcher>
+static void BM_KmpRandomText(benchmark::State& state) {
+  const auto alpha_size = static_cast<std::uint64_t>(state.range(0));
+  std::mt19937_64 generator(42);
+  std::string text(1ULL << 24, 'a');
+  for (char& c : text) {
+    c = static_cast<char>('a' + generator() % alpha_size);
+  }
+  const TMatcher matcher("abababbabababb");
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(matcher.count(text));
+  }
+  state.SetBytesProcessed(state.iterations() *
+                          static_cast<std::int64_t>(text.size()));
+}
+BENCHMARK(BM_KmpRandomText<TKmpMatcher>)->Arg(2)->Arg(26);
+BENCHMARK(BM_KmpRandomText<TKmpDfaMatcher<std::uint8_t>>)->Arg(2)->Arg(26);
+BENCHMARK(BM_KmpRandomText<TKmpDfaMatcher<std::uint16_t>>)->Arg(2)->Arg(26);
+
+BENCHMARK_MAIN();
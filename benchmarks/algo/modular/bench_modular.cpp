@@ -0,0 +1,123 @@
+#include <benchmark/benchmark.h>
+
+#include "algo/modular/modular.hpp"
+
+#include <random>
+#include <vector>
+
+using namespace NAds::NAlgo::NModular;
+
+namespace {
+
+__extension__ using TUint128 = unsigned __int128;
+
+constexpr std::size_t ValuesCount = 1024;
+
+// 2^64 - 59, prime
+constexpr std::uint64_t Modulus = 0xFFFF'FFFF'FFFF'FFC5ULL;
+
+[[nodiscard]] std::vector<std::uint64_t> randomValues(std::uint64_t seed) {
+  std::mt19937_64 generator(seed);
+  std::vector<std::uint64_t> values(ValuesCount);
+  for (std::uint64_t& value : values) {
+    value = generator();
+  }
+  return values;
+}
+
+// Baseline: 128-bit product and hardware division
+[[nodiscard]] std::uint64_t mulModDivision(std::uint64_t a, std::uint64_t b) {
+  return static_cast<std::uint64_t>(static_cast<TUint128>(a) * b % Modulus);
+}
+
+[[nodiscard]] std::uint64_t powModDivision(std::uint64_t base,
+                                           std::uint64_t exp) {
+  std::uint64_t result = 1;
+  for (; exp != 0; exp >>= 1) {
+    if ((exp & 1) != 0) {
+      result = mulModDivision(result, base);
+    }
+    base = mulModDivision(base, base);
+  }
+  return result;
+}
+
+}  // namespace
+
+// Chain of dependent multiplications, i.e. latency of one multiplication
+template <bool IsMontgomery>
+static void BM_MulModChain(benchmark::State& state) {
+  const std::vector<std::uint64_t> values = randomValues(42);
+  const TMontgomery engine(Modulus);
+  for (auto _ : state) {
+    std::uint64_t product = 1;
+    if constexpr (IsMontgomery) {
+      std::uint64_t product_mont = engine.one();
+      for (const std::uint64_t& value : values) {
+        product_mont = engine.mul(product_mont, value);
+      }
+      product = engine.fromMontgomery(product_mont);
+    } else {
+      for (const std::uint64_t& value : values) {
+        product = mulModDivision(product, value);
+      }
+    }
+    benchmark::DoNotOptimize(product);
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<std::int64_t>(values.size()));
+}
+BENCHMARK(BM_MulModChain<false>);
+BENCHMARK(BM_MulModChain<true>);
+
+template <bool IsMontgomery>
+static void BM_MulModSpan(benchmark::State& state) {
+  const std::vector<std::uint64_t> a = randomValues(42);
+  const std::vector<std::uint64_t> b = randomValues(43);
+  std::vector<std::uint64_t> out(a.size());
+  const TMontgomery engine(Modulus);
+  for (auto _ : state) {
+    if constexpr (IsMontgomery) {
+      engine.mulMod(a, b, out);
+    } else {
+      for (std::size_t i = 0; i < a.size(); ++i) {
+        out[i] = mulModDivision(a[i], b[i]);
+      }
+    }
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<std::int64_t>(a.size()));
+}
+BENCHMARK(BM_MulModSpan<false>);
+BENCHMARK(BM_MulModSpan<true>);
+
+// 0: division, 1: Montgomery one by one, 2: Montgomery span
+template <int Mode>
+static void BM_PowModSpan(benchmark::State& state) {
+  const std::vector<std::uint64_t> bases = randomValues(42);
+  std::vector<std::uint64_t> out(bases.size());
+  const TMontgomery engine(Modulus);
+  const std::uint64_t exp = Modulus - 2;
+  for (auto _ : state) {
+    if constexpr (Mode == 0) {
+      for (std::size_t i = 0; i < bases.size(); ++i) {
+        out[i] = powModDivision(bases[i], exp);
+      }
+    } else if constexpr (Mode == 1) {
+      for (std::size_t i = 0; i < bases.size(); ++i) {
+        out[i] = engine.powMod(bases[i], exp);
+      }
+    } else {
+      engine.powMod(bases, exp, out);
+    }
+    benchmark::DoNotOptimize(out.data());
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<std::int64_t>(bases.size()));
+}
+BENCHMARK(BM_PowModSpan<0>);
+BENCHMARK(BM_PowModSpan<1>);
+BENCHMARK(BM_PowModSpan<2>);
+
+BENCHMARK_MAIN();
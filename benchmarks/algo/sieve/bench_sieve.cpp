@@ -0,0 +1,167 @@
+#include <benchmark/benchmark.h>
+
+#include "algo/sieve/sieve.hpp"
+#include "algo/sieve/segmented_sieve.hpp"
+#include "algo/sieve/parallel_sieve.hpp"
+#include "algo/sieve/prime_pi.hpp"
+#include "algo/sieve/range_sieve.hpp"
+#include "algo/sieve/multiplicative_sieve.hpp"
+
+using namespace NAds::NAlgo::NSieve;
+
+namespace {
+
+constexpr std::int64_t ParallelSieveLimit = 1'000'000'000;
+
+// Per-function passes on top of createEratoSieve, the baseline for
+// createMultiplicativeTables
+TMultiplicativeTables createTablesPerFunction(const std::size_t& n) {
+  const std::vector<bool> is_prime = createEratoSieve(n);
+  TMultiplicativeTables tables;
+  tables.Phi.resize(n + 1);
+  for (std::size_t i = 0; i <= n; ++i) {
+    tables.Phi[i] = static_cast<std::uint32_t>(i);
+  }
+  tables.Mu.assign(n + 1, 1);
+  for (std::size_t p = 2; p <= n; ++p) {
+    if (!is_prime[p]) {
+      continue;
+    }
+    for (std::size_t j = p; j <= n; j += p) {
+      tables.Phi[j] -= tables.Phi[j] / static_cast<std::uint32_t>(p);
+      tables.Mu[j] = static_cast<std::int8_t>(-tables.Mu[j]);
+    }
+    for (std::size_t j = p * p; j <= n; j += p * p) {
+      tables.Mu[j] = 0;
+    }
+  }
+  tables.DivisorCount.assign(n + 1, 0);
+  tables.DivisorSum.assign(n + 1, 0);
+  for (std::size_t d = 1; d <= n; ++d) {
+    for (std::size_t j = d; j <= n; j += d) {
+      ++tables.DivisorCount[j];
+      tables.DivisorSum[j] += d;
+    }
+  }
+  return tables;
+}
+
+void threadCounts(benchmark::internal::Benchmark* bench) {
+  const auto max_threads =
+      static_cast<std::int64_t>(NAds::NAlgo::NParallel::defaultThreadCount());
+  for (std::int64_t threads = 1; threads < max_threads; threads *= 2) {
+    bench->Arg(threads);
+  }
+  bench->Arg(max_threads);
+}
+
+}  // namespace
+
+static void BM_EratoSieve(benchmark::State& state) {
+  const auto n = static_cast<std::size_t>(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(createEratoSieve(n));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_EratoSieve)
+    ->RangeMultiplier(10)
+    ->Range(1'000'000, 100'000'000)
+    ->Unit(benchmark::kMillisecond);
+
+// Throughput should stay flat as n grows
+static void BM_SegmentedCountPrimes(benchmark::State& state) {
+  const auto n = static_cast<std::uint64_t>(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(countPrimes(n));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SegmentedCountPrimes)
+    ->RangeMultiplier(10)
+    ->Range(1'000'000, 1'000'000'000)
+    ->Unit(benchmark::kMillisecond);
+
+// Argument is the number of threads, time should scale close to 1 / threads
+// up to the number of physical cores
+static void BM_ParallelCountPrimes(benchmark::State& state) {
+  const auto thread_count = static_cast<std::size_t>(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        parallelCountPrimes(ParallelSieveLimit, thread_count));
+  }
+  state.SetItemsProcessed(state.iterations() * ParallelSieveLimit);
+}
+BENCHMARK(BM_ParallelCountPrimes)
+    ->Apply(threadCounts)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+// Baseline for BM_PrimePi is BM_SegmentedCountPrimes with the same n
+static void BM_PrimePi(benchmark::State& state) {
+  const auto x = static_cast<std::uint64_t>(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(primePi(x));
+  }
+}
+BENCHMARK(BM_PrimePi)
+    ->RangeMultiplier(10)
+    ->Range(10'000'000, 10'000'000'000'000)
+    ->Unit(benchmark::kMillisecond);
+
+// Window [10^k, 10^k + 10^7], time is dominated by streaming base primes up
+// to sqrt(10^k) for large k
+static void BM_RangeSieve(benchmark::State& state) {
+  std::uint64_t low = 1;
+  for (std::int64_t i = 0; i < state.range(0); ++i) {
+    low *= 10;
+  }
+  const std::uint64_t width = 10'000'000;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(TRangeSieve(low, low + width).count());
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<std::int64_t>(width));
+}
+BENCHMARK(BM_RangeSieve)->DenseRange(10, 18, 4)->Unit(benchmark::kMillisecond);
+
+static void BM_MultiplicativeTablesPerFunction(benchmark::State& state) {
+  const auto n = static_cast<std::size_t>(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(createTablesPerFunction(n));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_MultiplicativeTablesPerFunction)
+    ->RangeMultiplier(10)
+    ->Range(1'000'000, 100'000'000)
+    ->Unit(benchmark::kMillisecond);
+
+static void BM_MultiplicativeTablesLinear(benchmark::State& state) {
+  const auto n = static_cast<std::uint32_t>(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(createMultiplicativeTables(n));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_MultiplicativeTablesLinear)
+    ->RangeMultiplier(10)
+    ->Range(1'000'000, 100'000'000)
+    ->Unit(benchmark::kMillisecond);
+
+static void BM_MultiplicativeTablesSegmented(benchmark::State& state) {
+  const auto n = static_cast<std::uint32_t>(state.range(0));
+  for (auto _ : state) {
+    TSegmentedMultiplicativeSieve sieve(n);
+    while (sieve.nextSegment()) {
+      benchmark::DoNotOptimize(sieve.segment().DivisorSum.data());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_MultiplicativeTablesSegmented)
+    ->RangeMultiplier(10)
+    ->Range(1'000'000, 100'000'000)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,214 @@
+#include <benchmark/benchmark.h>
+
+#include "algo/kmp/kmp.hpp"
+#include "algo/substr_search/simd_search.hpp"
+#include "algo/substr_search/parallel_search.hpp"
+#include "algo/substr_search/substr_searcher.hpp"
+
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace NAds::NAlgo;
+using namespace NAds::NAlgo::NSubstrSearch;
+
+namespace {
+
+constexpr std::size_t TextSize = 1ULL << 24;
+
+// Lowercase letters and spaces
+[[nodiscard]] std::string letterText() {
+  std::mt19937_64 generator(42);
+  std::string text(TextSize, ' ');
+  for (char& c : text) {
+    const std::uint64_t value = generator() % 27;
+    c = value == 26 ? ' ' : static_cast<char>('a' + value);
+  }
+  return text;
+}
+
+template <typename TSearcher>
+void runCount(benchmark::State& state, const std::string& text,
+              const std::string& pattern) {
+  const TSearcher searcher(pattern);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(searcher.count(text));
+  }
+  state.SetBytesProcessed(state.iterations() *
+                          static_cast<std::int64_t>(text.size()));
+}
+
+// Corpora of the search matrix
+enum class ECorpus {
+  // Words of a small vocabulary with Zipf frequencies
+  Natural,
+  // Uniform ACGT
+  Dna,
+  // Uniform bytes
+  Binary,
+};
+
+[[nodiscard]] std::string createCorpus(ECorpus corpus) {
+  std::mt19937_64 generator(42);
+  std::string text;
+  text.reserve(TextSize + 16);
+  if (corpus == ECorpus::Natural) {
+    const std::vector<std::string> words = {
+        "the",    "of",     "and",   "to",      "in",      "a",
+        "is",     "that",   "for",   "it",      "as",      "was",
+        "with",   "be",     "by",    "on",      "not",     "he",
+        "this",   "are",    "or",    "his",     "from",    "at",
+        "which",  "but",    "have",  "an",      "had",     "they",
+        "search", "window", "table", "pattern", "between", "character",
+        "period", "string", "shift", "suffix",  "prefix",  "automaton"};
+    std::vector<double> weights;
+    for (std::size_t i = 0; i < words.size(); ++i) {
+      weights.push_back(1.0 / static_cast<double>(i + 1));
+    }
+    std::discrete_distribution<std::size_t> word_ind(weights.begin(),
+                                                     weights.end());
+    while (text.size() < TextSize) {
+      text += words[word_ind(generator)];
+      text += ' ';
+    }
+  } else {
+    text.resize(TextSize);
+    for (char& c : text) {
+      c = corpus == ECorpus::Dna ? "ACGT"[generator() % 4]
+                                 : static_cast<char>(generator() % 256);
+    }
+  }
+  text.resize(TextSize);
+  return text;
+}
+
+template <ECorpus Corpus>
+[[nodiscard]] const std::string& corpusText() {
+  static const std::string text = createCorpus(Corpus);
+  return text;
+}
+
+void patternSizes(benchmark::internal::Benchmark* bench) {
+  bench->Arg(8)->Arg(32)->Arg(256);
+}
+
+void threadCounts(benchmark::internal::Benchmark* bench) {
+  const auto max_threads =
+      static_cast<std::int64_t>(NParallel::defaultThreadCount());
+  for (std::int64_t threads = 1; threads < max_threads; threads *= 2) {
+    bench->Arg(threads);
+  }
+  bench->Arg(max_threads);
+}
+
+}  // namespace
+
+// 16 MiB of random letters searched for an absent pattern of state.range(0)
+// chars
+template <typename TSearcher>
+static void BM_CountLetters(benchmark::State& state) {
+  const std::string pattern =
+      std::string("quick brown fox jumps over the lazy dog")
+          .substr(0, static_cast<std::size_t>(state.range(0)));
+  runCount<TSearcher>(state, letterText(), pattern);
+}
+BENCHMARK(BM_CountLetters<NKmp::TKmpMatcher>)->Arg(4)->Arg(16);
+BENCHMARK(BM_CountLetters<TSimdSearcher>)->Arg(4)->Arg(16);
+
+// Every position of the text is a candidate which fails late, the worst case
+// of the prefilter and of Horspool windows
+template <typename TSearcher>
+static void BM_CountAdversarial(benchmark::State& state) {
+  const std::string pattern = std::string(30, 'a') + 'b' + std::string(30, 'a');
+  runCount<TSearcher>(state, std::string(TextSize, 'a'), pattern);
+}
+BENCHMARK(BM_CountAdversarial<NKmp::TKmpMatcher>);
+BENCHMARK(BM_CountAdversarial<TSimdSearcher>);
+BENCHMARK(BM_CountAdversarial<THorspoolSearcher>);
+
+// Every position is an occurrence of a long periodic pattern, successful
+// comparisons alone would make the prefilter quadratic
+template <typename TSearcher>
+static void BM_CountAllMatches(benchmark::State& state) {
+  runCount<TSearcher>(state, std::string(1ULL << 22, 'a'),
+                      std::string(4096, 'a'));
+}
+BENCHMARK(BM_CountAllMatches<NKmp::TKmpMatcher>);
+BENCHMARK(BM_CountAllMatches<TSimdSearcher>);
+
+// 1 GiB of letters made of copies of a 16 MiB block. Argument is the number
+// of threads, time should scale close to 1 / threads until memory bandwidth
+// is saturated
+static void BM_ParallelCount(benchmark::State& state) {
+  const std::string block = letterText();
+  std::string text;
+  text.reserve(64 * block.size());
+  for (int i = 0; i < 64; ++i) {
+    text += block;
+  }
+  const TSimdSearcher searcher("quick brown fox");
+  const auto thread_count = static_cast<std::size_t>(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(parallelCount(searcher, text, thread_count));
+  }
+  state.SetBytesProcessed(state.iterations() *
+                          static_cast<std::int64_t>(text.size()));
+}
+BENCHMARK(BM_ParallelCount)
+    ->Apply(threadCounts)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+// Matrix of engines and corpora. The pattern of state.range(0) chars is cut
+// from the middle of the corpus, so it occurs at least once
+template <typename TSearcher, ECorpus Corpus>
+static void BM_SearchMatrix(benchmark::State& state) {
+  const std::string& text = corpusText<Corpus>();
+  runCount<TSearcher>(
+      state, text,
+      text.substr(text.size() / 2, static_cast<std::size_t>(state.range(0))));
+}
+BENCHMARK(BM_SearchMatrix<NKmp::TKmpMatcher, ECorpus::Natural>)
+    ->Apply(patternSizes);
+BENCHMARK(BM_SearchMatrix<NKmp::TKmpDfaMatcher<>, ECorpus::Natural>)
+    ->Apply(patternSizes);
+BENCHMARK(BM_SearchMatrix<TSimdSearcher, ECorpus::Natural>)
+    ->Apply(patternSizes);
+BENCHMARK(BM_SearchMatrix<THorspoolSearcher, ECorpus::Natural>)
+    ->Apply(patternSizes);
+BENCHMARK(BM_SearchMatrix<TTwoWaySearcher, ECorpus::Natural>)
+    ->Apply(patternSizes);
+BENCHMARK(BM_SearchMatrix<TZSearcher, ECorpus::Natural>)
+    ->Apply(patternSizes);
+BENCHMARK(BM_SearchMatrix<TSubstrSearcher, ECorpus::Natural>)
+    ->Apply(patternSizes);
+BENCHMARK(BM_SearchMatrix<NKmp::TKmpMatcher, ECorpus::Dna>)
+    ->Apply(patternSizes);
+BENCHMARK(BM_SearchMatrix<NKmp::TKmpDfaMatcher<>, ECorpus::Dna>)
+    ->Apply(patternSizes);
+BENCHMARK(BM_SearchMatrix<TSimdSearcher, ECorpus::Dna>)
+    ->Apply(patternSizes);
+BENCHMARK(BM_SearchMatrix<THorspoolSearcher, ECorpus::Dna>)
+    ->Apply(patternSizes);
+BENCHMARK(BM_SearchMatrix<TTwoWaySearcher, ECorpus::Dna>)
+    ->Apply(patternSizes);
+BENCHMARK(BM_SearchMatrix<TZSearcher, ECorpus::Dna>)
+    ->Apply(patternSizes);
+BENCHMARK(BM_SearchMatrix<TSubstrSearcher, ECorpus::Dna>)
+    ->Apply(patternSizes);
+BENCHMARK(BM_SearchMatrix<NKmp::TKmpMatcher, ECorpus::Binary>)
+    ->Apply(patternSizes);
+BENCHMARK(BM_SearchMatrix<NKmp::TKmpDfaMatcher<>, ECorpus::Binary>)
+    ->Apply(patternSizes);
+BENCHMARK(BM_SearchMatrix<TSimdSearcher, ECorpus::Binary>)
+    ->Apply(patternSizes);
+BENCHMARK(BM_SearchMatrix<THorspoolSearcher, ECorpus::Binary>)
+    ->Apply(patternSizes);
+BENCHMARK(BM_SearchMatrix<TTwoWaySearcher, ECorpus::Binary>)
+    ->Apply(patternSizes);
+BENCHMARK(BM_SearchMatrix<TZSearcher, ECorpus::Binary>)
+    ->Apply(patternSizes);
+BENCHMARK(BM_SearchMatrix<TSubstrSearcher, ECorpus::Binary>)
+    ->Apply(patternSizes);
+
+BENCHMARK_MAIN();
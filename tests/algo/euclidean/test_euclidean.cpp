@@ -1,9 +1,53 @@
 #include <gtest/gtest.h>
 
 #include "algo/euclidean/euclidean.hpp"
+#include "algo/euclidean/big_gcd.hpp"
+
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
 
 using namespace NAds::NAlgo::NEuclidean;
 
+namespace {
+
+__extension__ using TUint128 = unsigned __int128;
+
+using TLimbs = std::vector<std::uint64_t>;
+
+[[nodiscard]] TLimbs randomLimbs(std::mt19937_64& generator,
+                                 std::size_t size) {
+  TLimbs result(size);
+  for (std::uint64_t& limb : result) {
+    limb = generator();
+  }
+  result.back() |= 1ULL << 63;
+  return result;
+}
+
+// Schoolbook product, trimmed
+[[nodiscard]] TLimbs multiply(const TLimbs& a, const TLimbs& b) {
+  TLimbs result(a.size() + b.size(), 0);
+  for (std::size_t i = 0; i < a.size(); ++i) {
+    std::uint64_t carry = 0;
+    for (std::size_t j = 0; j < b.size(); ++j) {
+      const TUint128 sum =
+          static_cast<TUint128>(a[i]) * b[j] + result[i + j] + carry;
+      result[i + j] = static_cast<std::uint64_t>(sum);
+      carry = static_cast<std::uint64_t>(sum >> 64);
+    }
+    result[i + b.size()] = carry;
+  }
+  while (!result.empty() && result.back() == 0) {
+    result.pop_back();
+  }
+  return result;
+}
+
+}  // namespace
+
 // TODO: add tests
 TEST(Euclidean, TestGCD) {
   EXPECT_EQ(gcd(30, 24), 6);
@@ -11,10 +55,246 @@ TEST(Euclidean, TestGCD) {
   EXPECT_EQ(gcd(30, 100), 10);
 }
 
+TEST(Euclidean, TestGCDAlgorithms) {
+  static_assert(gcd<EGcdAlgorithm::Euclid>(30, 24) == 6);
+  static_assert(gcd<EGcdAlgorithm::Binary>(30, 24) == 6);
+  static_assert(gcd<EGcdAlgorithm::Binary>(0, 0) == 0);
+  static_assert(gcd<EGcdAlgorithm::Binary>(0, 7) == 7);
+  static_assert(gcd<EGcdAlgorithm::Binary>(1ULL << 63, 1ULL << 40) ==
+                1ULL << 40);
+  // Consecutive Fibonacci numbers are the worst case of Euclid
+  EXPECT_EQ(gcd<EGcdAlgorithm::Binary>(7'540'113'804'746'346'429ULL,
+                                       4'660'046'610'375'530'309ULL),
+            1);
+  std::mt19937_64 generator(42);
+  for (int i = 0; i < 10'000; ++i) {
+    const std::uint64_t common = generator() % 1000 + 1;
+    const std::uint64_t a = (generator() >> (generator() % 64)) * common;
+    const std::uint64_t b = (generator() >> (generator() % 64)) * common;
+    EXPECT_EQ(gcd<EGcdAlgorithm::Binary>(a, b),
+              gcd<EGcdAlgorithm::Euclid>(a, b));
+  }
+}
+
+TEST(Euclidean, TestGCDBatch) {
+  std::mt19937_64 generator(42);
+  for (const std::size_t size : {0ULL, 1ULL, 7ULL, 8ULL, 9ULL, 1000ULL}) {
+    std::vector<std::uint64_t> a(size);
+    std::vector<std::uint64_t> b(size);
+    for (std::size_t i = 0; i < size; ++i) {
+      const std::uint64_t common = generator() % 100 + 1;
+      a[i] = (i % 5 == 0) ? 0 : (generator() >> (generator() % 64)) * common;
+      b[i] = (i % 7 == 0) ? 0 : (generator() >> (generator() % 64)) * common;
+    }
+    std::vector<std::uint64_t> out(size);
+    gcdBatch(a, b, out);
+    for (std::size_t i = 0; i < size; ++i) {
+      EXPECT_EQ(out[i], gcd<EGcdAlgorithm::Euclid>(a[i], b[i]));
+    }
+  }
+  std::vector<std::uint64_t> out(2);
+  EXPECT_THROW(gcdBatch(std::vector<std::uint64_t>(2),
+                        std::vector<std::uint64_t>(3), out),
+               std::range_error);
+}
+
+TEST(Euclidean, TestGCDReduce) {
+  EXPECT_EQ(gcdReduce({}), 0);
+  EXPECT_EQ(gcdReduce(std::vector<std::uint64_t>{0, 0, 12}), 12);
+  EXPECT_EQ(gcdReduce(std::vector<std::uint64_t>{6, 10, 15}), 1);
+  std::mt19937_64 generator(42);
+  for (const std::size_t size : {1ULL, 8ULL, 13ULL, 1000ULL}) {
+    std::vector<std::uint64_t> values(size);
+    for (std::uint64_t& value : values) {
+      value = (generator() % 1'000'000) * 720;
+    }
+    std::uint64_t expected = 0;
+    for (const std::uint64_t& value : values) {
+      expected = gcd<EGcdAlgorithm::Euclid>(expected, value);
+    }
+    EXPECT_EQ(gcdReduce(values), expected);
+    values.push_back(1);
+    EXPECT_EQ(gcdReduce(values), 1);
+  }
+}
+
+TEST(Euclidean, TestExtendedGCD) {
+  __extension__ using TInt128 = __int128;
+  const std::uint64_t max = std::numeric_limits<std::uint64_t>::max();
+  std::vector<std::pair<std::uint64_t, std::uint64_t>> pairs = {
+      {0, 0}, {0, 5}, {5, 0}, {7, 7}, {240, 46}, {max, max - 1}, {1, max}};
+  std::mt19937_64 generator(42);
+  for (int i = 0; i < 10'000; ++i) {
+    pairs.emplace_back(generator() >> (generator() % 64), generator());
+  }
+  for (const auto& [a, b] : pairs) {
+    const TExtendedGcd result = extendedGcd(a, b);
+    EXPECT_EQ(result.Gcd, gcd(a, b));
+    EXPECT_EQ(static_cast<TInt128>(a) * result.X +
+                  static_cast<TInt128>(b) * result.Y,
+              static_cast<TInt128>(result.Gcd));
+  }
+}
+
+TEST(Euclidean, TestModInverse) {
+  EXPECT_EQ(modInverse(3, 11), 4);
+  EXPECT_EQ(modInverse(10, 17), 12);
+  EXPECT_EQ(modInverse(25, 1), 0);
+  EXPECT_THROW(static_cast<void>(modInverse(6, 9)), std::range_error);
+  EXPECT_THROW(static_cast<void>(modInverse(0, 7)), std::range_error);
+  EXPECT_THROW(static_cast<void>(modInverse(3, 0)), std::range_error);
+  __extension__ using TUint128 = unsigned __int128;
+  std::mt19937_64 generator(42);
+  for (int i = 0; i < 10'000; ++i) {
+    const std::uint64_t modulus = (generator() >> (generator() % 64)) | 1;
+    const std::uint64_t a = generator();
+    if (gcd(a, modulus) != 1) {
+      continue;
+    }
+    const std::uint64_t inverse = modInverse(a, modulus);
+    EXPECT_LT(inverse, modulus);
+    EXPECT_EQ(static_cast<TUint128>(a) * inverse % modulus, 1 % modulus);
+  }
+}
+
+TEST(Euclidean, TestModInverseBatch) {
+  const std::uint64_t modulus = 998'244'353;
+  std::mt19937_64 generator(42);
+  for (const std::size_t size : {0ULL, 1ULL, 2ULL, 1000ULL}) {
+    std::vector<std::uint64_t> values(size);
+    for (std::uint64_t& value : values) {
+      value = generator() % (modulus - 1) + 1;
+    }
+    // Values are not required to be reduced
+    if (!values.empty()) {
+      values.front() += modulus;
+    }
+    std::vector<std::uint64_t> out(size);
+    modInverseBatch(values, modulus, out);
+    for (std::size_t i = 0; i < size; ++i) {
+      EXPECT_EQ(out[i], modInverse(values[i], modulus));
+    }
+  }
+  const std::vector<std::uint64_t> values = {3, 5, 10};
+  std::vector<std::uint64_t> out(3);
+  EXPECT_THROW(modInverseBatch(values, 25, out), std::range_error);
+  EXPECT_THROW(modInverseBatch(values, 0, out), std::range_error);
+  std::vector<std::uint64_t> short_out(2);
+  EXPECT_THROW(modInverseBatch(values, 7, short_out), std::range_error);
+}
+
+TEST(Euclidean, TestBigGCD) {
+  EXPECT_EQ(bigGcd({}, {}), TLimbs{});
+  EXPECT_EQ(bigGcd(TLimbs{0, 0}, TLimbs{12, 0}), TLimbs{12});
+  EXPECT_EQ(bigGcd(TLimbs{30}, TLimbs{24}), TLimbs{6});
+  // 2^300 * 3 = gcd(2^500 * 3, 2^300 * 9)
+  TLimbs a(8, 0);
+  a[7] = 3ULL << (500 - 448);
+  TLimbs b(5, 0);
+  b[4] = 9ULL << (300 - 256);
+  TLimbs expected(5, 0);
+  expected[4] = 3ULL << (300 - 256);
+  EXPECT_EQ(bigGcd(a, b), expected);
+  EXPECT_EQ(bigGcdEuclid(a, b), expected);
+  // The first quotient estimate of the long division is one too large and
+  // the divisor is added back
+  EXPECT_EQ(bigGcdEuclid(TLimbs{3, 0, 1ULL << 63}, TLimbs{1, 0, 1ULL << 61}),
+            TLimbs{1});
+  // Consecutive Fibonacci numbers of about 2000 bits are coprime
+  TLimbs previous = {1};
+  TLimbs current = {1};
+  for (int i = 0; i < 2900; ++i) {
+    TLimbs next(current.size() + 1, 0);
+    std::uint64_t carry = 0;
+    for (std::size_t j = 0; j < current.size(); ++j) {
+      const std::uint64_t prev = j < previous.size() ? previous[j] : 0;
+      const TUint128 sum = static_cast<TUint128>(current[j]) + prev + carry;
+      next[j] = static_cast<std::uint64_t>(sum);
+      carry = static_cast<std::uint64_t>(sum >> 64);
+    }
+    next.back() = carry;
+    if (next.back() == 0) {
+      next.pop_back();
+    }
+    previous = std::move(current);
+    current = std::move(next);
+  }
+  EXPECT_EQ(bigGcd(current, previous), TLimbs{1});
+  EXPECT_EQ(bigGcdEuclid(current, previous), TLimbs{1});
+  std::mt19937_64 generator(42);
+  for (int i = 0; i < 200; ++i) {
+    const TLimbs common = randomLimbs(generator, generator() % 4 + 1);
+    const TLimbs x =
+        multiply(common, randomLimbs(generator, generator() % 20 + 1));
+    const TLimbs y =
+        multiply(common, randomLimbs(generator, generator() % 20 + 1));
+    const TLimbs result = bigGcd(x, y);
+    EXPECT_EQ(result, bigGcdEuclid(x, y));
+    EXPECT_EQ(result, bigGcd(y, x));
+    // common divides the result
+    EXPECT_EQ(bigGcd(result, common), common);
+  }
+  // Single-limb arguments agree with gcd
+  for (int i = 0; i < 1000; ++i) {
+    const std::uint64_t x = generator() >> (generator() % 64);
+    const std::uint64_t y = generator() >> (generator() % 64);
+    const std::uint64_t expected_gcd = gcd(x, y);
+    EXPECT_EQ(bigGcd(TLimbs{x}, TLimbs{y}),
+              expected_gcd == 0 ? TLimbs{} : TLimbs{expected_gcd});
+  }
+}
+
 TEST(Euclidean, TestLCM) {
   EXPECT_EQ(lcm(3, 24), 24);
   EXPECT_EQ(lcm(30, 4), 60);
   EXPECT_EQ(lcm(30, 15), 30);
+  EXPECT_EQ(lcm(0, 15), 0);
+  EXPECT_EQ(lcm(0, 0), 0);
+  // a * b overflows, lcm does not
+  EXPECT_EQ(lcm(3ULL << 59, 5ULL << 58), 15ULL << 59);
+}
+
+TEST(Euclidean, TestCheckedLCM) {
+  const std::uint64_t max = std::numeric_limits<std::uint64_t>::max();
+  TCheckedLcm result = checkedLcm(3ULL << 59, 5ULL << 58);
+  EXPECT_EQ(result.Value, 15ULL << 59);
+  EXPECT_FALSE(result.IsSaturated);
+  result = checkedLcm(max, max - 1);
+  EXPECT_EQ(result.Value, max);
+  EXPECT_TRUE(result.IsSaturated);
+  result = checkedLcm(max, max);
+  EXPECT_EQ(result.Value, max);
+  EXPECT_FALSE(result.IsSaturated);
+  result = checkedLcm(1ULL << 32, (1ULL << 32) - 1);
+  EXPECT_EQ(result.Value, (1ULL << 32) * ((1ULL << 32) - 1));
+  EXPECT_FALSE(result.IsSaturated);
+  result = checkedLcm(0, max);
+  EXPECT_EQ(result.Value, 0);
+  EXPECT_FALSE(result.IsSaturated);
+}
+
+TEST(Euclidean, TestLCMReduce) {
+  TCheckedLcm result = lcmReduce({});
+  EXPECT_EQ(result.Value, 1);
+  EXPECT_FALSE(result.IsSaturated);
+  std::vector<std::uint64_t> values;
+  for (std::uint64_t value = 1; value <= 20; ++value) {
+    values.push_back(value);
+  }
+  result = lcmReduce(values);
+  EXPECT_EQ(result.Value, 232'792'560);
+  EXPECT_FALSE(result.IsSaturated);
+  // lcm(1, ..., 43) < 2^64 < lcm(1, ..., 47)
+  for (std::uint64_t value = 21; value <= 100; ++value) {
+    values.push_back(value);
+  }
+  result = lcmReduce(values);
+  EXPECT_EQ(result.Value, std::numeric_limits<std::uint64_t>::max());
+  EXPECT_TRUE(result.IsSaturated);
+  values.push_back(0);
+  result = lcmReduce(values);
+  EXPECT_EQ(result.Value, 0);
+  EXPECT_FALSE(result.IsSaturated);
 }
 
 int main(int argc, char* argv[]) {
@@ -3,6 +3,14 @@
 #include "algo/expect_equality.hpp"
 #include "algo/kmp/kmp.hpp"
 
+#include <algorithm>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
 using namespace NAds::NAlgo;
 using namespace NAds::NAlgo::NKmp;
 
@@ -14,6 +22,156 @@ TEST(KMP, Test1) {
   expectVectorEquality(kmpSubstrSearch("", "a"), {});
 }
 
+TEST(KMP, TestByteSpan) {
+  // Zero and non-ASCII bytes are ordinary chars
+  const std::string text("ab\0ab\0\xFF" "ab", 9);
+  const std::string pattern("b\0", 2);
+  const std::vector<std::size_t> expected = {1, 4};
+  expectVectorEquality(kmpSubstrSearch(std::as_bytes(std::span(text)),
+                                       std::as_bytes(std::span(pattern))),
+                       expected);
+  expectVectorEquality(kmpSubstrSearch(std::string_view(text), pattern),
+                       expected);
+}
+
+namespace {
+
+// Occurrences by comparison at every position
+[[nodiscard]] std::vector<std::size_t> naiveSearch(const std::string& text,
+                                                   const std::string& pattern) {
+  std::vector<std::size_t> occurrences;
+  for (std::size_t i = 0; i + pattern.size() <= text.size(); ++i) {
+    if (text.compare(i, pattern.size(), pattern) == 0) {
+      occurrences.push_back(i);
+    }
+  }
+  return occurrences;
+}
+
+[[nodiscard]] std::string randomString(std::mt19937_64& generator,
+                                       std::size_t size,
+                                       std::uint64_t alpha_size) {
+  std::string s(size, 'a');
+  for (char& c : s) {
+    c = static_cast<char>('a' + generator() % alpha_size);
+  }
+  return s;
+}
+
+}  // namespace
+
+TEST(KMP, TestMatcher) {
+  const TKmpMatcher matcher("abc");
+  EXPECT_EQ(matcher.pattern(), "abc");
+  expectVectorEquality(matcher.findAll("ababcabcababc"), {2, 5, 10});
+  EXPECT_EQ(matcher.findFirst("ababcabcababc"), 2);
+  EXPECT_EQ(matcher.findFirst("ababab"), std::string_view::npos);
+  EXPECT_EQ(matcher.count("ababcabcababc"), 3);
+  EXPECT_EQ(matcher.count(""), 0);
+  EXPECT_THROW(TKmpMatcher(""), std::range_error);
+  std::mt19937_64 generator(42);
+  for (int i = 0; i < 200; ++i) {
+    const std::string pattern =
+        randomString(generator, generator() % 6 + 1, 2);
+    const std::string text = randomString(generator, generator() % 200, 2);
+    const TKmpMatcher random_matcher(pattern);
+    const std::vector<std::size_t> expected = naiveSearch(text, pattern);
+    expectVectorEquality(random_matcher.findAll(text), expected);
+    EXPECT_EQ(random_matcher.count(text), expected.size());
+    EXPECT_EQ(random_matcher.findFirst(text),
+              expected.empty() ? std::string_view::npos : expected.front());
+  }
+}
+
+TEST(KMP, TestMatcherSharedByThreads) {
+  const TKmpMatcher matcher("aba");
+  std::mt19937_64 generator(42);
+  const std::string text = randomString(generator, 100'000, 2);
+  const std::size_t expected = naiveSearch(text, "aba").size();
+  std::vector<std::size_t> counts(4);
+  std::vector<std::thread> threads;
+  for (std::size_t i = 0; i < counts.size(); ++i) {
+    threads.emplace_back(
+        [&matcher, &text, &counts, i] { counts[i] = matcher.count(text); });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  for (const std::size_t& count : counts) {
+    EXPECT_EQ(count, expected);
+  }
+}
+
+TEST(KMP, TestStreamMatcher) {
+  TKmpStreamMatcher stream("abab");
+  std::vector<std::uint64_t> occurrences = stream.feed("xxab");
+  EXPECT_TRUE(occurrences.empty());
+  occurrences = stream.feed("a");
+  EXPECT_TRUE(occurrences.empty());
+  occurrences = stream.feed("");
+  EXPECT_TRUE(occurrences.empty());
+  occurrences = stream.feed("babx");
+  expectVectorEquality(occurrences, {2, 4});
+  EXPECT_EQ(stream.offset(), 9);
+  stream.reset();
+  EXPECT_EQ(stream.offset(), 0);
+  expectVectorEquality(stream.feed("abab"), {0});
+  EXPECT_THROW(TKmpStreamMatcher(""), std::range_error);
+  std::mt19937_64 generator(42);
+  for (int i = 0; i < 100; ++i) {
+    const std::string pattern =
+        randomString(generator, generator() % 8 + 1, 2);
+    const std::string text = randomString(generator, generator() % 2000, 2);
+    const std::vector<std::size_t> expected = naiveSearch(text, pattern);
+    TKmpStreamMatcher random_stream{TKmpMatcher(pattern)};
+    std::vector<std::size_t> found;
+    for (std::size_t begin = 0; begin < text.size();) {
+      const std::size_t chunk_size =
+          std::min<std::size_t>(generator() % 10, text.size() - begin);
+      random_stream.feed(std::string_view(text).substr(begin, chunk_size),
+                         [&found](std::uint64_t offset) {
+                           found.push_back(static_cast<std::size_t>(offset));
+                         });
+      begin += chunk_size;
+    }
+    expectVectorEquality(found, expected);
+  }
+}
+
+TEST(KMP, TestDfaMatcher) {
+  const TKmpDfaMatcher<std::uint8_t> matcher("abc");
+  EXPECT_EQ(matcher.pattern(), "abc");
+  expectVectorEquality(matcher.findAll("ababcabcababc"), {2, 5, 10});
+  EXPECT_EQ(matcher.findFirst("ababcabcababc"), 2);
+  EXPECT_EQ(matcher.findFirst("ababab"), std::string_view::npos);
+  EXPECT_EQ(matcher.count("ababcabcababc"), 3);
+  EXPECT_THROW(TKmpDfaMatcher<std::uint8_t>(""), std::range_error);
+  EXPECT_THROW(TKmpDfaMatcher<std::uint8_t>(std::string(256, 'a')),
+               std::range_error);
+  const TKmpDfaMatcher<std::uint8_t> longest(std::string(255, 'a'));
+  EXPECT_EQ(longest.count(std::string(300, 'a')), 46);
+  const std::string binary_pattern("\xFF\0\xFF", 3);
+  const std::string binary_text("\xFF\0\xFF\0\xFF\x7F", 6);
+  expectVectorEquality(TKmpDfaMatcher<>(binary_pattern).findAll(binary_text),
+                       {0, 2});
+  std::mt19937_64 generator(42);
+  for (int i = 0; i < 200; ++i) {
+    const std::uint64_t alpha_size = generator() % 3 + 1;
+    const std::string pattern =
+        randomString(generator, generator() % 10 + 1, alpha_size);
+    const std::string text =
+        randomString(generator, generator() % 300, alpha_size);
+    const std::vector<std::size_t> expected = naiveSearch(text, pattern);
+    const TKmpDfaMatcher<std::uint8_t> small_matcher(pattern);
+    const TKmpDfaMatcher<std::uint16_t> wide_matcher(pattern);
+    expectVectorEquality(small_matcher.findAll(text), expected);
+    expectVectorEquality(wide_matcher.findAll(text), expected);
+    EXPECT_EQ(wide_matcher.count(text), expected.size());
+    EXPECT_EQ(small_matcher.findFirst(text),
+              expected.empty() ? std::string_view::npos : expected.front());
+  }
+}
+
 int main(int argc, char* argv[]) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
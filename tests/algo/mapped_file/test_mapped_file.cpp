@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+
+#include "algo/expect_equality.hpp"
+#include "algo/mapped_file/mapped_file.hpp"
+#include "algo/bytes/bytes.hpp"
+#include "algo/kmp/kmp.hpp"
+#include "ds/aho_corasick/aho_corasick.hpp"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <unistd.h>
+
+using namespace NAds::NAlgo;
+using namespace NAds::NAlgo::NMappedFile;
+
+namespace {
+
+// Creates a file with the given contents and removes it at scope exit. The
+// name gets the process id, so concurrent test runs do not collide
+class TTempFile {
+public:
+  TTempFile(const std::string& name, const std::string& contents)
+      : Path_(std::filesystem::temp_directory_path() /
+              (name + "_" + std::to_string(::getpid()))) {
+    std::ofstream out(Path_, std::ios::binary);
+    out << contents;
+  }
+
+  TTempFile(const TTempFile& other) = delete;
+
+  TTempFile& operator=(const TTempFile& other) = delete;
+
+  ~TTempFile() {
+    std::filesystem::remove(Path_);
+  }
+
+  [[nodiscard]] std::string path() const {
+    return Path_.string();
+  }
+
+private:
+  std::filesystem::path Path_;
+};
+
+}  // namespace
+
+TEST(MappedFile, Contents) {
+  std::string contents(100'000, 'a');
+  for (std::size_t i = 0; i < contents.size(); ++i) {
+    contents[i] = static_cast<char>(i * 7919 % 256);
+  }
+  const TTempFile file("ads_test_mapped_file_contents", contents);
+  const TMappedFile mapped(file.path());
+  EXPECT_EQ(mapped.size(), contents.size());
+  EXPECT_EQ(mapped.view(), contents);
+  EXPECT_EQ(mapped.bytes().size(), contents.size());
+  EXPECT_TRUE(std::equal(mapped.bytes().begin(), mapped.bytes().end(),
+                         std::as_bytes(std::span(contents)).begin()));
+  EXPECT_EQ(NBytes::asStringView(mapped.bytes()).data(),
+            mapped.view().data());
+}
+
+TEST(MappedFile, EmptyFile) {
+  const TTempFile file("ads_test_mapped_file_empty", "");
+  const TMappedFile mapped(file.path());
+  EXPECT_EQ(mapped.size(), 0);
+  EXPECT_TRUE(mapped.view().empty());
+  EXPECT_TRUE(mapped.bytes().empty());
+}
+
+TEST(MappedFile, MissingFile) {
+  EXPECT_THROW(TMappedFile("/nonexistent/ads_test_mapped_file"),
+               std::runtime_error);
+}
+
+TEST(MappedFile, Move) {
+  const TTempFile first_file("ads_test_mapped_file_first", "first");
+  const TTempFile second_file("ads_test_mapped_file_second", "second file");
+  TMappedFile first(first_file.path());
+  TMappedFile moved(std::move(first));
+  EXPECT_EQ(moved.view(), "first");
+  TMappedFile second(second_file.path());
+  moved = std::move(second);
+  EXPECT_EQ(moved.view(), "second file");
+  EXPECT_EQ(moved.size(), 11);
+}
+
+// Bytes of the mapping go to the searchers without a copy
+TEST(MappedFile, Search) {
+  std::string contents;
+  for (int i = 0; i < 10'000; ++i) {
+    contents += i % 1000 == 0 ? "needle\n" : "hay\n";
+  }
+  const TTempFile file("ads_test_mapped_file_search", contents);
+  const TMappedFile mapped(file.path());
+  std::vector<std::size_t> expected;
+  for (std::size_t pos = contents.find("needle"); pos != std::string::npos;
+       pos = contents.find("needle", pos + 1)) {
+    expected.push_back(pos);
+  }
+  EXPECT_EQ(expected.size(), 10);
+  const std::string pattern = "needle";
+  expectVectorEquality(
+      NKmp::kmpSubstrSearch(mapped.bytes(), std::as_bytes(std::span(pattern))),
+      expected);
+  NAds::NDs::NAhoCorasick::TAhoCorasick<'a', 'z'> automata;
+  automata.addString("needle");
+  automata.addString("hay");
+  std::size_t needles_count = 0;
+  std::size_t hays_count = 0;
+  for (const auto& occurrence : automata.findAllOccurrences(mapped.bytes())) {
+    if (occurrence.StrNum == 0) {
+      EXPECT_EQ(occurrence.StrStartPos, expected[needles_count]);
+      ++needles_count;
+    } else {
+      ++hays_count;
+    }
+  }
+  EXPECT_EQ(needles_count, expected.size());
+  EXPECT_EQ(hays_count, 10'000 - expected.size());
+}
+
+int main(int argc, char* argv[]) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
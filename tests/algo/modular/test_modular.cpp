@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+
+#include "algo/modular/modular.hpp"
+
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using namespace NAds::NAlgo::NModular;
+
+namespace {
+
+__extension__ using TUint128 = unsigned __int128;
+
+[[nodiscard]] std::uint64_t mulModWide(std::uint64_t a, std::uint64_t b,
+                                       std::uint64_t modulus) {
+  return static_cast<std::uint64_t>(static_cast<TUint128>(a) * b % modulus);
+}
+
+[[nodiscard]] std::uint64_t powModWide(std::uint64_t base, std::uint64_t exp,
+                                       std::uint64_t modulus) {
+  std::uint64_t result = 1 % modulus;
+  for (base %= modulus; exp != 0; exp >>= 1) {
+    if ((exp & 1) != 0) {
+      result = mulModWide(result, base, modulus);
+    }
+    base = mulModWide(base, base, modulus);
+  }
+  return result;
+}
+
+}  // namespace
+
+TEST(Modular, TestMontgomery) {
+  EXPECT_THROW(TMontgomery(0), std::range_error);
+  EXPECT_THROW(TMontgomery(1), std::range_error);
+  EXPECT_THROW(TMontgomery(1ULL << 40), std::range_error);
+  static_assert(TMontgomery(7).mulMod(5, 6) == 2);
+  static_assert(TMontgomery(1'000'000'007).powMod(2, 1'000'000'006) == 1);
+  const std::uint64_t max = std::numeric_limits<std::uint64_t>::max();
+  std::mt19937_64 generator(42);
+  for (const std::uint64_t modulus :
+       std::vector<std::uint64_t>{3, 998'244'353, max, max - 58}) {
+    const TMontgomery engine(modulus);
+    EXPECT_EQ(engine.modulus(), modulus);
+    EXPECT_EQ(engine.fromMontgomery(engine.one()), 1);
+    for (int i = 0; i < 1000; ++i) {
+      const std::uint64_t a = generator();
+      const std::uint64_t b = generator();
+      const std::uint64_t a_mont = engine.toMontgomery(a);
+      const std::uint64_t b_mont = engine.toMontgomery(b);
+      EXPECT_EQ(engine.fromMontgomery(a_mont), a % modulus);
+      EXPECT_EQ(engine.mulMod(a, b), mulModWide(a, b, modulus));
+      EXPECT_EQ(engine.fromMontgomery(engine.mul(a_mont, b_mont)),
+                mulModWide(a, b, modulus));
+      EXPECT_EQ(engine.fromMontgomery(engine.add(a_mont, b_mont)),
+                static_cast<std::uint64_t>(
+                    (static_cast<TUint128>(a % modulus) + b % modulus) %
+                    modulus));
+      EXPECT_EQ(engine.fromMontgomery(engine.sub(a_mont, b_mont)),
+                static_cast<std::uint64_t>(
+                    (static_cast<TUint128>(a % modulus) + modulus -
+                     b % modulus) %
+                    modulus));
+      const std::uint64_t exp = generator() >> (generator() % 64);
+      EXPECT_EQ(engine.powMod(a, exp), powModWide(a, exp, modulus));
+    }
+  }
+}
+
+TEST(Modular, TestMontgomerySpans) {
+  const TMontgomery engine(0xFFFF'FFFF'FFFF'FFC5ULL);
+  std::mt19937_64 generator(42);
+  for (const std::size_t size : {0ULL, 1ULL, 7ULL, 8ULL, 9ULL, 1000ULL}) {
+    std::vector<std::uint64_t> a(size);
+    std::vector<std::uint64_t> b(size);
+    for (std::size_t i = 0; i < size; ++i) {
+      a[i] = generator();
+      b[i] = generator();
+    }
+    std::vector<std::uint64_t> out(size);
+    engine.mulMod(a, b, out);
+    for (std::size_t i = 0; i < size; ++i) {
+      EXPECT_EQ(out[i], engine.mulMod(a[i], b[i]));
+    }
+    for (const std::uint64_t exp :
+         std::vector<std::uint64_t>{0, 1, 65537, generator()}) {
+      engine.powMod(a, exp, out);
+      for (std::size_t i = 0; i < size; ++i) {
+        EXPECT_EQ(out[i], engine.powMod(a[i], exp));
+      }
+    }
+  }
+  std::vector<std::uint64_t> out(2);
+  EXPECT_THROW(engine.mulMod(std::vector<std::uint64_t>(2),
+                             std::vector<std::uint64_t>(3), out),
+               std::range_error);
+  EXPECT_THROW(engine.powMod(std::vector<std::uint64_t>(3), 2, out),
+               std::range_error);
+}
+
+TEST(Modular, TestModInt) {
+  constexpr std::uint64_t Mod = 998'244'353;
+  using TMint = TModInt<Mod>;
+  static_assert((TMint(Mod - 1) + TMint(5)).value() == 4);
+  static_assert((TMint(3) - TMint(5)).value() == Mod - 2);
+  static_assert((TMint(1ULL << 40) * TMint(1ULL << 40)).value() ==
+                (1ULL << 40) % Mod * ((1ULL << 40) % Mod) % Mod);
+  static_assert(TMint(3).pow(Mod - 1) == TMint(1));
+  static_assert(TMint().value() == 0);
+  EXPECT_EQ((TMint(3).inverse() * TMint(3)).value(), 1);
+  EXPECT_THROW(static_cast<void>(TMint(0).inverse()), std::range_error);
+  std::mt19937_64 generator(42);
+  TMint product(1);
+  std::uint64_t expected = 1;
+  for (int i = 0; i < 1000; ++i) {
+    const std::uint64_t value = generator();
+    product *= TMint(value);
+    expected = mulModWide(expected, value, Mod);
+  }
+  EXPECT_EQ(product.value(), expected);
+}
+
+int main(int argc, char* argv[]) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
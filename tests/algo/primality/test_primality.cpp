@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+
+#include "algo/expect_equality.hpp"
+#include "algo/primality/primality.hpp"
+#include "algo/sieve/sieve.hpp"
+
+#include <random>
+#include <stdexcept>
+
+using namespace NAds::NAlgo;
+using namespace NAds::NAlgo::NPrimality;
+
+namespace {
+
+[[nodiscard]] std::uint64_t product(const std::vector<std::uint64_t>& factors) {
+  std::uint64_t result = 1;
+  for (const std::uint64_t& factor : factors) {
+    result *= factor;
+  }
+  return result;
+}
+
+}  // namespace
+
+TEST(Primality, SmallNumbers) {
+  const std::size_t n = 2'000'000;
+  const std::vector<bool> sieve = NSieve::createEratoSieve(n);
+  for (std::size_t i = 0; i <= n; ++i) {
+    EXPECT_EQ(isPrime(i), sieve[i]) << i;
+  }
+}
+
+TEST(Primality, LargePrimes) {
+  EXPECT_TRUE(isPrime(4'294'967'291ULL));
+  EXPECT_TRUE(isPrime(1'000'000'007ULL));
+  EXPECT_TRUE(isPrime(999'999'999'989ULL));
+  EXPECT_TRUE(isPrime(2'305'843'009'213'693'951ULL));
+  EXPECT_TRUE(isPrime(18'446'744'073'709'551'557ULL));
+}
+
+TEST(Primality, LargeComposites) {
+  // Carmichael numbers
+  EXPECT_FALSE(isPrime(561));
+  EXPECT_FALSE(isPrime(41'041));
+  EXPECT_FALSE(isPrime(825'265));
+  EXPECT_FALSE(isPrime(2'301'745'249ULL));
+  // Strong pseudoprimes to several first prime bases
+  EXPECT_FALSE(isPrime(2'047));
+  EXPECT_FALSE(isPrime(3'215'031'751ULL));
+  EXPECT_FALSE(isPrime(3'825'123'056'546'413'051ULL));
+  // Products of two large primes
+  EXPECT_FALSE(isPrime(4'294'967'291ULL * 4'294'967'279ULL));
+  EXPECT_FALSE(isPrime(1'000'000'007ULL * 998'244'353ULL));
+  EXPECT_FALSE(isPrime(65'521ULL * 65'519ULL));
+  EXPECT_FALSE(isPrime(18'446'744'073'709'551'615ULL));
+}
+
+TEST(Primality, CompareWithTrialDivision) {
+  std::mt19937_64 generator(42);
+  for (int i = 0; i < 2'000; ++i) {
+    const std::uint64_t n = generator() % 1'000'000'000'000ULL + 1'000'000;
+    bool expected = (n % 2 != 0);
+    for (std::uint64_t d = 3; expected && d * d <= n; d += 2) {
+      expected = (n % d != 0);
+    }
+    EXPECT_EQ(isPrime(n), expected) << n;
+  }
+}
+
+TEST(Factorization, SmallNumbers) {
+  EXPECT_THROW(static_cast<void>(factor(0)), std::range_error);
+  EXPECT_TRUE(factor(1).empty());
+  expectVectorEquality(factor(2), {2});
+  expectVectorEquality(factor(360), {2, 2, 2, 3, 3, 5});
+  expectVectorEquality(factor(1'048'576), std::vector<std::uint64_t>(20, 2));
+  expectVectorEquality(factor(999'983), {999'983});
+}
+
+TEST(Factorization, LargeNumbers) {
+  expectVectorEquality(factor(4'294'967'291ULL * 4'294'967'279ULL),
+                       {4'294'967'279ULL, 4'294'967'291ULL});
+  expectVectorEquality(factor(1'000'000'007ULL * 1'000'000'007ULL),
+                       {1'000'000'007ULL, 1'000'000'007ULL});
+  expectVectorEquality(factor(18'446'744'073'709'551'615ULL),
+                       {3, 5, 17, 257, 641, 65'537, 6'700'417});
+  expectVectorEquality(factor(18'446'744'073'709'551'557ULL),
+                       {18'446'744'073'709'551'557ULL});
+  expectVectorEquality(factor(2'097'143ULL * 2'097'143ULL * 2'097'143ULL),
+                       {2'097'143ULL, 2'097'143ULL, 2'097'143ULL});
+}
+
+TEST(Factorization, RandomNumbers) {
+  std::mt19937_64 generator(42);
+  for (int i = 0; i < 500; ++i) {
+    const std::uint64_t n = generator() | 1;
+    const std::vector<std::uint64_t> factors = factor(n);
+    EXPECT_EQ(product(factors), n);
+    for (std::size_t j = 0; j < factors.size(); ++j) {
+      EXPECT_TRUE(isPrime(factors[j])) << factors[j];
+      if (j > 0) {
+        EXPECT_LE(factors[j - 1], factors[j]);
+      }
+    }
+  }
+}
+
+int main(int argc, char* argv[]) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -2,6 +2,24 @@
 
 #include "algo/expect_equality.hpp"
 #include "algo/sieve/sieve.hpp"
+#include "algo/sieve/segmented_sieve.hpp"
+#include "algo/sieve/wheel_sieve.hpp"
+#include "algo/sieve/parallel_sieve.hpp"
+#include "algo/sieve/linear_sieve.hpp"
+#include "algo/sieve/prime_range.hpp"
+#include "algo/sieve/prime_pi.hpp"
+#include "algo/sieve/prime_table.hpp"
+#include "algo/sieve/range_sieve.hpp"
+#include "algo/sieve/presieve.hpp"
+#include "algo/sieve/multiplicative_sieve.hpp"
+
+#include <ranges>
+#include <bit>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include <unistd.h>
 
 using namespace NAds::NAlgo;
 using namespace NAds::NAlgo::NSieve;
@@ -28,6 +46,504 @@ TEST(SieveOfEratosthenes, ExpectThrow) {
   EXPECT_THROW(static_cast<void>(createEratoSieve(0)), std::runtime_error);
 }
 
+TEST(ConstexprSieve, CompileTime) {
+  static_assert(!isSmallPrime(0) && !isSmallPrime(1) && isSmallPrime(2));
+  static_assert(isSmallPrime(65521) && !isSmallPrime(65535));
+  constexpr std::array<std::uint64_t, 2> bits = createConstexprSieve<100>();
+  static_assert(std::popcount(bits[0]) + std::popcount(bits[1]) == 25);
+}
+
+TEST(ConstexprSieve, MatchesEratoSieve) {
+  const std::vector<bool> is_prime = createEratoSieve(ConstexprSieveLimit);
+  for (std::uint64_t x = 0; x <= ConstexprSieveLimit; ++x) {
+    EXPECT_EQ(isSmallPrime(x), is_prime[x]);
+  }
+  EXPECT_THROW(static_cast<void>(isSmallPrime(ConstexprSieveLimit + 1)),
+               std::out_of_range);
+}
+
+namespace {
+
+std::vector<std::uint64_t> primesFromEratoSieve(const std::size_t& n) {
+  const std::vector<bool> is_prime = createEratoSieve(n);
+  std::vector<std::uint64_t> primes;
+  for (std::size_t i = 0; i <= n; ++i) {
+    if (is_prime[i]) {
+      primes.push_back(i);
+    }
+  }
+  return primes;
+}
+
+}  // namespace
+
+TEST(Presieve, MatchesTrialDivision) {
+  for (const std::uint64_t low : {0ULL, 1ULL, 2ULL, 17ULL, 64ULL, 12345ULL,
+                                  1'000'000'000'007ULL}) {
+    for (const std::size_t words_count : {1ULL, 3ULL, 5ULL, 300ULL, 2000ULL}) {
+      std::vector<std::uint64_t> bitmap(words_count);
+      presieve(low, bitmap);
+      for (std::uint64_t i = 0; i < 64 * words_count; ++i) {
+        const std::uint64_t x = low + i;
+        bool expected = (x >= 2);
+        for (const std::uint64_t prime : {2ULL, 3ULL, 5ULL, 7ULL, 11ULL, 13ULL,
+                                          17ULL}) {
+          expected = expected && (x == prime || x % prime != 0);
+        }
+        EXPECT_EQ(((bitmap[i / 64] >> (i % 64)) & 1ULL) != 0, expected) << x;
+      }
+    }
+  }
+}
+
+TEST(SegmentedSieve, SmallBounds) {
+  expectVectorEquality(segmentedSievePrimes(0), {});
+  expectVectorEquality(segmentedSievePrimes(1), {});
+  expectVectorEquality(segmentedSievePrimes(2), {2});
+  expectVectorEquality(segmentedSievePrimes(16), {2, 3, 5, 7, 11, 13});
+}
+
+TEST(SegmentedSieve, MatchesEratoSieve) {
+  for (const std::size_t n : {100ULL, 1000ULL, 65537ULL, 1000000ULL}) {
+    for (const std::size_t segment_size : {1ULL, 64ULL, 1000ULL, 1ULL << 18}) {
+      expectVectorEquality(segmentedSievePrimes(n, segment_size),
+                           primesFromEratoSieve(n));
+    }
+  }
+}
+
+TEST(SegmentedSieve, SegmentBitmaps) {
+  TSegmentedSieve sieve(200, 64);
+  const std::vector<bool> is_prime = createEratoSieve(200);
+  std::uint64_t expected_low = 0;
+  while (sieve.nextSegment()) {
+    EXPECT_EQ(sieve.segmentLow(), expected_low);
+    EXPECT_LE(sieve.segmentHigh(), 200);
+    for (std::uint64_t x = sieve.segmentLow(); x <= sieve.segmentHigh(); ++x) {
+      EXPECT_EQ(sieve.isPrime(x), is_prime[x]);
+    }
+    expected_low = sieve.segmentHigh() + 1;
+  }
+  EXPECT_EQ(expected_low, 201);
+  EXPECT_THROW(static_cast<void>(sieve.isPrime(10)), std::out_of_range);
+}
+
+TEST(SegmentedSieve, CountPrimes) {
+  EXPECT_EQ(countPrimes(10), 4);
+  EXPECT_EQ(countPrimes(1000000), 78498);
+  EXPECT_EQ(countPrimes(10000000, 1000), 664579);
+  EXPECT_EQ(countPrimes(100000000), 5761455);
+}
+
+TEST(SegmentedSieve, Range) {
+  const std::vector<bool> is_prime = createEratoSieve(10000);
+  for (const std::uint64_t low : {0ULL, 1ULL, 2ULL, 97ULL, 5000ULL}) {
+    TSegmentedSieve sieve(createBasePrimes(10000), low, 10000, 100);
+    std::vector<std::uint64_t> expected_primes;
+    for (std::uint64_t x = low; x <= 10000; ++x) {
+      if (is_prime[x]) {
+        expected_primes.push_back(x);
+      }
+    }
+    std::vector<std::uint64_t> primes;
+    sieve.forEachPrime(
+        [&primes](const std::uint64_t& prime) { primes.push_back(prime); });
+    expectVectorEquality(primes, expected_primes);
+  }
+}
+
+TEST(SegmentedSieve, ExpectThrow) {
+  EXPECT_THROW(TSegmentedSieve(100, 0), std::range_error);
+  EXPECT_THROW(TSegmentedSieve(createBasePrimes(100), 50, 49),
+               std::range_error);
+}
+
+TEST(WheelSieve, IsPrime) {
+  for (const std::size_t n : {1ULL, 2ULL, 7ULL, 29ULL, 30ULL, 31ULL, 1000ULL,
+                              123457ULL}) {
+    const TWheelSieve wheel_sieve(n);
+    const std::vector<bool> is_prime = createEratoSieve(n);
+    for (std::uint64_t x = 0; x <= n; ++x) {
+      EXPECT_EQ(wheel_sieve.isPrime(x), is_prime[x]);
+    }
+    EXPECT_THROW(static_cast<void>(wheel_sieve.isPrime(n + 1)),
+                 std::out_of_range);
+  }
+}
+
+TEST(WheelSieve, Iteration) {
+  for (const std::size_t n : {1ULL, 5ULL, 100ULL, 999983ULL}) {
+    const TWheelSieve wheel_sieve(n);
+    const std::vector<std::uint64_t> expected_primes = primesFromEratoSieve(n);
+    expectVectorEquality(wheel_sieve.primes(), expected_primes);
+    EXPECT_EQ(wheel_sieve.count(), expected_primes.size());
+  }
+  EXPECT_EQ(TWheelSieve(100000000).count(), 5761455);
+}
+
+TEST(WheelSieve, MemoryUsage) {
+  EXPECT_EQ(TWheelSieve(30000).memoryUsage(), 1001);
+}
+
+TEST(WheelSieve, ExpectThrow) {
+  EXPECT_THROW(TWheelSieve(0), std::range_error);
+}
+
+TEST(ParallelSieve, MatchesSegmentedSieve) {
+  for (const std::size_t thread_count : {1ULL, 2ULL, 3ULL, 8ULL}) {
+    for (const std::uint64_t n : {1ULL, 2ULL, 1000ULL, 1000000ULL}) {
+      expectVectorEquality(parallelSievePrimes(n, thread_count, 64),
+                           segmentedSievePrimes(n));
+      EXPECT_EQ(parallelCountPrimes(n, thread_count, 64), countPrimes(n));
+    }
+  }
+}
+
+TEST(ParallelSieve, CountPrimes) {
+  EXPECT_EQ(parallelCountPrimes(10000000, 4, 1000), 664579);
+  EXPECT_EQ(parallelCountPrimes(100000000), 5761455);
+}
+
+TEST(LinearSieve, IsPrime) {
+  for (const std::uint32_t n : {1U, 2U, 3U, 9U, 10U, 65537U, 1000000U}) {
+    const TLinearSieve linear_sieve(n);
+    const std::vector<bool> is_prime = createEratoSieve(n);
+    for (std::uint32_t x = 0; x <= n; ++x) {
+      EXPECT_EQ(linear_sieve.isPrime(x), is_prime[x]);
+    }
+  }
+}
+
+TEST(LinearSieve, SmallestPrimeFactor) {
+  const TLinearSieve linear_sieve(100000);
+  for (std::uint32_t x = 2; x <= 100000; ++x) {
+    std::uint32_t expected_factor = 2;
+    while (x % expected_factor != 0) {
+      ++expected_factor;
+    }
+    EXPECT_EQ(linear_sieve.smallestPrimeFactor(x), expected_factor);
+  }
+}
+
+TEST(LinearSieve, Factorize) {
+  const TLinearSieve linear_sieve(1000000);
+  expectVectorEquality(linear_sieve.factorize(1), {});
+  expectVectorEquality(linear_sieve.factorize(2), {2});
+  expectVectorEquality(linear_sieve.factorize(999983), {999983});
+  expectVectorEquality(linear_sieve.factorize(999999),
+                       {3, 3, 3, 7, 11, 13, 37});
+  expectVectorEquality(linear_sieve.factorize(1U << 19),
+                       std::vector<std::uint32_t>(19, 2));
+  expectVectorEquality(linear_sieve.factorize(997 * 997), {997, 997});
+}
+
+TEST(LinearSieve, FactorizeBatch) {
+  const TLinearSieve linear_sieve(1000);
+  const std::vector<std::uint32_t> values = {12, 1, 997, 1000};
+  const TLinearSieve::TBatchFactorization factorization =
+      linear_sieve.factorizeBatch(values);
+  expectVectorEquality(factorization.Offsets, {0, 3, 3, 4, 10});
+  expectVectorEquality(factorization.Factors,
+                       {2, 2, 3, 997, 2, 2, 2, 5, 5, 5});
+}
+
+TEST(LinearSieve, ExpectThrow) {
+  EXPECT_THROW(TLinearSieve(0), std::range_error);
+  const TLinearSieve linear_sieve(100);
+  EXPECT_THROW(static_cast<void>(linear_sieve.factorize(0)), std::range_error);
+  EXPECT_THROW(static_cast<void>(linear_sieve.factorize(101)),
+               std::out_of_range);
+  EXPECT_THROW(static_cast<void>(linear_sieve.smallestPrimeFactor(1)),
+               std::range_error);
+}
+
+TEST(PrimeRange, RangesCompatibility) {
+  static_assert(std::ranges::input_range<TPrimeRange>);
+  static_assert(std::ranges::view<TPrimeRange>);
+  std::vector<std::uint64_t> primes;
+  for (const std::uint64_t prime :
+       TPrimeRange() | std::views::take(6) |
+           std::views::filter([](const std::uint64_t& x) { return x > 2; })) {
+    primes.push_back(prime);
+  }
+  expectVectorEquality(primes, {3, 5, 7, 11, 13});
+}
+
+TEST(PrimeRange, BoundedRange) {
+  for (const std::uint64_t from : {0ULL, 2ULL, 3ULL, 500ULL}) {
+    std::vector<std::uint64_t> expected_primes;
+    for (const std::uint64_t prime : primesFromEratoSieve(1000000)) {
+      if (prime >= from) {
+        expected_primes.push_back(prime);
+      }
+    }
+    std::vector<std::uint64_t> primes;
+    for (const std::uint64_t prime : TPrimeRange(from, 1000000)) {
+      primes.push_back(prime);
+    }
+    expectVectorEquality(primes, expected_primes);
+  }
+  TPrimeRange empty_range(10, 5);
+  EXPECT_TRUE(empty_range.begin() == empty_range.end());
+  TPrimeRange no_primes_range(24, 28);
+  EXPECT_TRUE(no_primes_range.begin() == no_primes_range.end());
+}
+
+TEST(PrimeRange, SinglePass) {
+  TPrimeRange range(10, 30);
+  auto it = range.begin();
+  EXPECT_EQ(*it, 11);
+  ++it;
+  EXPECT_EQ(*range.begin(), 13);
+}
+
+TEST(PrimeRange, NextPrimes) {
+  expectVectorEquality(nextPrimes(0, 5), {2, 3, 5, 7, 11});
+  expectVectorEquality(nextPrimes(7, 3), {11, 13, 17});
+  expectVectorEquality(nextPrimes(10, 0), {});
+  expectVectorEquality(nextPrimes(1000000000000ULL, 3),
+                       {1000000000039ULL, 1000000000061ULL, 1000000000063ULL});
+  EXPECT_EQ(nextPrimes(0, 100000).back(), 1299709);
+}
+
+TEST(PrimePi, MatchesSieve) {
+  for (const std::uint64_t x : {0ULL, 1ULL, 2ULL, 100ULL, 9999999ULL,
+                                10000000ULL, 10000019ULL, 12345678ULL,
+                                99999999ULL, 100000000ULL, 223092870ULL}) {
+    EXPECT_EQ(primePi(x), countPrimes(x));
+  }
+}
+
+TEST(PrimePi, KnownValues) {
+  EXPECT_EQ(primePi(1000000000ULL), 50847534ULL);
+  EXPECT_EQ(primePi(10000000000ULL), 455052511ULL);
+  EXPECT_EQ(primePi(100000000000ULL), 4118054813ULL);
+}
+
+namespace {
+
+// The name gets the process id, so concurrent test runs do not collide
+[[nodiscard]] std::string tempPath(const std::string& name) {
+  return (std::filesystem::temp_directory_path() /
+          (name + "_" + std::to_string(::getpid()) + ".bin"))
+      .string();
+}
+
+}  // namespace
+
+TEST(PrimeTable, SaveAndLoad) {
+  const std::string path = tempPath("test_sieve_prime_table");
+  const TWheelSieve wheel_sieve(1000003);
+  savePrimeTable(wheel_sieve.view(), path);
+  EXPECT_EQ(std::filesystem::file_size(path),
+            sizeof(TPrimeTableHeader) + wheel_sieve.memoryUsage());
+  TMappedPrimeTable table = loadPrimeTable(path);
+  const TWheelSieveView view = table.view();
+  EXPECT_EQ(view.limit(), 1000003);
+  EXPECT_EQ(table.count(), wheel_sieve.count());
+  EXPECT_EQ(view.count(), wheel_sieve.count());
+  expectVectorEquality(view.primes(), wheel_sieve.primes());
+  const TMappedPrimeTable moved_table = std::move(table);
+  EXPECT_TRUE(moved_table.view().isPrime(1000003));
+  EXPECT_FALSE(moved_table.view().isPrime(1000001));
+  EXPECT_THROW(static_cast<void>(table.view()), std::runtime_error);
+  std::filesystem::remove(path);
+}
+
+TEST(PrimeTable, ExpectThrow) {
+  const std::string path = tempPath("test_sieve_bad_table");
+  EXPECT_THROW(TMappedPrimeTable("/nonexistent/prime_table.bin"),
+               std::runtime_error);
+  {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out << "not a prime table at all, but long enough for the header";
+  }
+  EXPECT_THROW(TMappedPrimeTable{path}, std::runtime_error);
+  savePrimeTable(TWheelSieve(1000).view(), path);
+  std::filesystem::resize_file(path, std::filesystem::file_size(path) - 1);
+  EXPECT_THROW(TMappedPrimeTable{path}, std::runtime_error);
+  std::filesystem::remove(path);
+}
+
+TEST(RangeSieve, MatchesEratoSieve) {
+  const std::vector<bool> is_prime = createEratoSieve(10000);
+  for (const std::uint64_t low : {0ULL, 1ULL, 2ULL, 3ULL, 97ULL, 5000ULL}) {
+    for (const std::uint64_t high :
+         std::vector<std::uint64_t>{low, low + 1, low + 63, 10000}) {
+      const TRangeSieve sieve(low, high);
+      std::vector<std::uint64_t> expected_primes;
+      for (std::uint64_t x = low; x <= high; ++x) {
+        EXPECT_EQ(sieve.isPrime(x), is_prime[x]);
+        if (is_prime[x]) {
+          expected_primes.push_back(x);
+        }
+      }
+      expectVectorEquality(sieve.primes(), expected_primes);
+      EXPECT_EQ(sieve.count(), expected_primes.size());
+    }
+  }
+}
+
+TEST(RangeSieve, LargeBounds) {
+  const std::uint64_t low = 100'000'000'000'000ULL;
+  const std::uint64_t high = low + 100'000;
+  TSegmentedSieve segmented_sieve(createBasePrimes(high), low, high);
+  std::vector<std::uint64_t> expected_primes;
+  segmented_sieve.forEachPrime([&expected_primes](const std::uint64_t& prime) {
+    expected_primes.push_back(prime);
+  });
+  expectVectorEquality(TRangeSieve(low, high).primes(), expected_primes);
+
+  const std::uint64_t low_16 = 10'000'000'000'000'000ULL;
+  expectVectorEquality(
+      TRangeSieve(low_16, low_16 + 100).primes(),
+      {low_16 + 61, low_16 + 69, low_16 + 79, low_16 + 99});
+}
+
+TEST(RangeSieve, Batch) {
+  const std::vector<TRangeWindow> windows = {
+      {.Low = 0, .High = 1000},
+      {.Low = 1'000'000'000'000ULL, .High = 1'000'000'100'000ULL},
+      {.Low = 77, .High = 77},
+      {.Low = 10'000'000'000ULL, .High = 10'000'050'000ULL}};
+  for (const std::size_t thread_count : {1ULL, 2ULL, 8ULL}) {
+    const std::vector<TRangeSieve> sieves =
+        rangeSieveBatch(windows, thread_count);
+    ASSERT_EQ(sieves.size(), windows.size());
+    for (std::size_t i = 0; i < windows.size(); ++i) {
+      EXPECT_EQ(sieves[i].low(), windows[i].Low);
+      EXPECT_EQ(sieves[i].high(), windows[i].High);
+      expectVectorEquality(
+          sieves[i].primes(),
+          TRangeSieve(windows[i].Low, windows[i].High).primes());
+    }
+  }
+  EXPECT_TRUE(rangeSieveBatch({}).empty());
+}
+
+TEST(RangeSieve, MemoryUsage) {
+  EXPECT_EQ(TRangeSieve(1'000'000'000'000ULL, 1'000'000'006'399ULL)
+                .memoryUsage(),
+            800);
+}
+
+TEST(RangeSieve, ExpectThrow) {
+  EXPECT_THROW(TRangeSieve(50, 49), std::range_error);
+  const TRangeSieve sieve(100, 200);
+  EXPECT_THROW(static_cast<void>(sieve.isPrime(99)), std::out_of_range);
+  EXPECT_THROW(static_cast<void>(sieve.isPrime(201)), std::out_of_range);
+}
+
+namespace {
+
+// Multiplicative functions of x by trial division
+TMultiplicativeTables multiplicativeTablesByTrialDivision(
+    const std::uint64_t& n) {
+  TMultiplicativeTables tables;
+  for (std::uint64_t x = 0; x <= n; ++x) {
+    std::uint64_t phi = x;
+    std::int64_t mu = 1;
+    std::uint64_t count = 1;
+    std::uint64_t sum = 1;
+    std::uint64_t rest = x;
+    for (std::uint64_t prime = 2; x != 0 && prime <= rest; ++prime) {
+      std::uint64_t exponent = 0;
+      std::uint64_t power_sum = 1;
+      std::uint64_t power = 1;
+      for (; rest % prime == 0; rest /= prime) {
+        ++exponent;
+        power *= prime;
+        power_sum += power;
+      }
+      if (exponent != 0) {
+        phi = phi / prime * (prime - 1);
+        mu = (exponent == 1 ? -mu : 0);
+        count *= exponent + 1;
+        sum *= power_sum;
+      }
+    }
+    tables.Phi.push_back(static_cast<std::uint32_t>(phi));
+    tables.Mu.push_back(static_cast<std::int8_t>(x == 0 ? 0 : mu));
+    tables.DivisorCount.push_back(
+        static_cast<std::uint16_t>(x == 0 ? 0 : count));
+    tables.DivisorSum.push_back(x == 0 ? 0 : sum);
+  }
+  return tables;
+}
+
+void expectTablesEquality(const TMultiplicativeTables& computed,
+                          const TMultiplicativeTables& expected) {
+  EXPECT_EQ(computed.Low, expected.Low);
+  expectVectorEquality(computed.Phi, expected.Phi);
+  expectVectorEquality(computed.Mu, expected.Mu);
+  expectVectorEquality(computed.DivisorCount, expected.DivisorCount);
+  expectVectorEquality(computed.DivisorSum, expected.DivisorSum);
+}
+
+// Concatenation of all segments
+TMultiplicativeTables collectSegments(TSegmentedMultiplicativeSieve& sieve) {
+  TMultiplicativeTables tables;
+  while (sieve.nextSegment()) {
+    const TMultiplicativeTables& segment = sieve.segment();
+    EXPECT_EQ(segment.Low, tables.Phi.size());
+    tables.Phi.insert(tables.Phi.end(), segment.Phi.begin(),
+                      segment.Phi.end());
+    tables.Mu.insert(tables.Mu.end(), segment.Mu.begin(), segment.Mu.end());
+    tables.DivisorCount.insert(tables.DivisorCount.end(),
+                               segment.DivisorCount.begin(),
+                               segment.DivisorCount.end());
+    tables.DivisorSum.insert(tables.DivisorSum.end(),
+                             segment.DivisorSum.begin(),
+                             segment.DivisorSum.end());
+  }
+  return tables;
+}
+
+}  // namespace
+
+TEST(MultiplicativeSieve, MatchesTrialDivision) {
+  for (const std::uint32_t n : {0U, 1U, 2U, 10U, 5000U}) {
+    const TMultiplicativeTables expected =
+        multiplicativeTablesByTrialDivision(n);
+    expectTablesEquality(createMultiplicativeTables(n), expected);
+    for (const std::size_t segment_size : {1ULL, 7ULL, 64ULL, 1ULL << 16}) {
+      TSegmentedMultiplicativeSieve sieve(n, {}, segment_size);
+      expectTablesEquality(collectSegments(sieve), expected);
+    }
+  }
+}
+
+TEST(MultiplicativeSieve, LinearMatchesSegmented) {
+  const std::uint32_t n = 1'000'000;
+  TSegmentedMultiplicativeSieve sieve(n, {}, 1000);
+  expectTablesEquality(collectSegments(sieve), createMultiplicativeTables(n));
+}
+
+TEST(MultiplicativeSieve, SelectedFunctions) {
+  const TMultiplicativeFunctions functions = {.Phi = false,
+                                              .Mu = true,
+                                              .DivisorCount = false,
+                                              .DivisorSum = true};
+  const TMultiplicativeTables tables =
+      createMultiplicativeTables(100, functions);
+  EXPECT_TRUE(tables.Phi.empty());
+  EXPECT_TRUE(tables.DivisorCount.empty());
+  EXPECT_EQ(tables.Mu.size(), 101);
+  EXPECT_EQ(tables.DivisorSum[100], 217);
+  TSegmentedMultiplicativeSieve sieve(100, functions, 64);
+  ASSERT_TRUE(sieve.nextSegment());
+  EXPECT_TRUE(sieve.segment().Phi.empty());
+  EXPECT_EQ(sieve.segment().Mu[30], -1);
+  ASSERT_TRUE(sieve.nextSegment());
+  EXPECT_EQ(sieve.segment().Low, 64);
+  EXPECT_EQ(sieve.segment().DivisorSum.size(), 37);
+  EXPECT_FALSE(sieve.nextSegment());
+}
+
+TEST(MultiplicativeSieve, ExpectThrow) {
+  EXPECT_THROW(TSegmentedMultiplicativeSieve(10, {}, 0), std::range_error);
+}
+
 int main(int argc, char* argv[]) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
@@ -0,0 +1,232 @@
+#include <gtest/gtest.h>
+
+#include "algo/expect_equality.hpp"
+#include "algo/substr_search/simd_search.hpp"
+#include "algo/substr_search/parallel_search.hpp"
+#include "algo/substr_search/substr_searcher.hpp"
+
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace NAds::NAlgo;
+using namespace NAds::NAlgo::NSubstrSearch;
+
+namespace {
+
+// Occurrences by comparison at every position
+[[nodiscard]] std::vector<std::size_t> naiveSearch(const std::string& text,
+                                                   const std::string& pattern) {
+  std::vector<std::size_t> occurrences;
+  for (std::size_t i = 0; i + pattern.size() <= text.size(); ++i) {
+    if (text.compare(i, pattern.size(), pattern) == 0) {
+      occurrences.push_back(i);
+    }
+  }
+  return occurrences;
+}
+
+[[nodiscard]] std::string randomString(std::mt19937_64& generator,
+                                       std::size_t size,
+                                       std::uint64_t alpha_size) {
+  std::string s(size, 'a');
+  for (char& c : s) {
+    c = static_cast<char>('a' + generator() % alpha_size);
+  }
+  return s;
+}
+
+// Every search method agrees with the naive search
+template <typename TSearcher>
+void expectNaiveEquality(const TSearcher& searcher, const std::string& text) {
+  const std::vector<std::size_t> expected =
+      naiveSearch(text, searcher.pattern());
+  expectVectorEquality(searcher.findAll(text), expected);
+  EXPECT_EQ(searcher.count(text), expected.size());
+  EXPECT_EQ(searcher.findFirst(text),
+            expected.empty() ? std::string_view::npos : expected.front());
+}
+
+}  // namespace
+
+TEST(SimdSearch, Simple) {
+  const TSimdSearcher searcher("abc");
+  EXPECT_EQ(searcher.pattern(), "abc");
+  expectVectorEquality(searcher.findAll("ababcabcababc"), {2, 5, 10});
+  EXPECT_EQ(searcher.findFirst("ababcabcababc"), 2);
+  EXPECT_EQ(searcher.findFirst("ababab"), std::string_view::npos);
+  EXPECT_EQ(searcher.count("ababcabcababc"), 3);
+  EXPECT_EQ(searcher.count("ab"), 0);
+  expectVectorEquality(TSimdSearcher("a").findAll("abaa"), {0, 2, 3});
+  expectVectorEquality(TSimdSearcher("aa").findAll("aaaa"), {0, 1, 2});
+  EXPECT_THROW(TSimdSearcher(""), std::range_error);
+}
+
+TEST(SimdSearch, RandomTexts) {
+  std::mt19937_64 generator(42);
+  for (int i = 0; i < 300; ++i) {
+    const std::uint64_t alpha_size = generator() % 4 + 1;
+    const std::string pattern =
+        randomString(generator, generator() % 40 + 1, alpha_size);
+    const std::string text =
+        randomString(generator, generator() % 300, alpha_size);
+    expectNaiveEquality(TSimdSearcher(pattern), text);
+  }
+}
+
+TEST(SimdSearch, Bytes) {
+  std::mt19937_64 generator(42);
+  std::string text(1000, '\0');
+  for (char& c : text) {
+    c = static_cast<char>(generator() % 4 == 0 ? 0xFF : generator() % 256);
+  }
+  const std::string pattern = text.substr(500, 3);
+  expectNaiveEquality(TSimdSearcher(pattern), text);
+}
+
+// Every position is a candidate and fails late, so the search leaves the
+// text to the automaton. Occurrences before and after the switch are found
+TEST(SimdSearch, AdversarialPattern) {
+  const std::string pattern = std::string(30, 'a') + 'b' + std::string(30, 'a');
+  std::string text(20'000, 'a');
+  const std::vector<std::size_t> occurrences = {5, 1000, 9000, 19'000};
+  for (const std::size_t pos : occurrences) {
+    text[pos + 30] = 'b';
+  }
+  expectNaiveEquality(TSimdSearcher(pattern), text);
+}
+
+// Every position is an occurrence of a periodic pattern. Successful
+// comparisons are charged too, so the search switches to the automaton and
+// occurrences on both sides of the switch are reported once
+TEST(SimdSearch, AllMatches) {
+  const std::string pattern(1000, 'a');
+  expectNaiveEquality(TSimdSearcher(pattern), std::string(50'000, 'a'));
+  std::string periodic;
+  for (int i = 0; i < 5000; ++i) {
+    periodic += "abc";
+  }
+  expectNaiveEquality(TSimdSearcher(periodic.substr(0, 600)), periodic);
+}
+
+// Chunks have at least 2^20 start positions, occurrences are put across the
+// borders of the first chunks
+TEST(ParallelSearch, ChunkBorders) {
+  std::mt19937_64 generator(42);
+  const std::string pattern = "abcab";
+  std::string text = randomString(generator, (1ULL << 22) + 17, 3);
+  // Border i is crossed by an occurrence starting i chars before it
+  for (std::size_t i = 1; i < pattern.size(); ++i) {
+    text.replace((i << 20) - i, pattern.size(), pattern);
+  }
+  const TSimdSearcher searcher(pattern);
+  const std::vector<std::size_t> expected = searcher.findAll(text);
+  expectVectorEquality(expected, naiveSearch(text, pattern));
+  const std::vector<std::size_t> thread_counts = {1, 2, 3, 8};
+  for (const std::size_t thread_count : thread_counts) {
+    expectVectorEquality(parallelFindAll(searcher, text, thread_count),
+                         expected);
+    EXPECT_EQ(parallelCount(searcher, text, thread_count), expected.size());
+  }
+  expectVectorEquality(parallelSubstrSearch(text, pattern), expected);
+}
+
+TEST(ParallelSearch, ShortTexts) {
+  const TSimdSearcher searcher("abc");
+  expectVectorEquality(parallelFindAll(searcher, "", 4), {});
+  expectVectorEquality(parallelFindAll(searcher, "ab", 4), {});
+  expectVectorEquality(parallelFindAll(searcher, "abcabc", 4), {0, 3});
+  EXPECT_EQ(parallelCount(searcher, "abcabc", 4), 2);
+  EXPECT_THROW(static_cast<void>(parallelSubstrSearch("abc", "")),
+               std::range_error);
+}
+
+TEST(ZFunction, Values) {
+  expectVectorEquality(zFunction("aaaaa"), {0, 4, 3, 2, 1});
+  expectVectorEquality(zFunction("aaabaab"), {0, 2, 1, 0, 2, 1, 0});
+  expectVectorEquality(zFunction("abacaba"), {0, 0, 1, 0, 3, 0, 1});
+  expectVectorEquality(zFunction(""), {});
+}
+
+// Every engine agrees with the naive search on random texts over small
+// alphabets, where periodic patterns and overlapping occurrences are common
+TEST(SubstrSearcher, EnginesRandomTexts) {
+  const std::vector<ESearchEngine> engines = {
+      ESearchEngine::Simd, ESearchEngine::Horspool, ESearchEngine::TwoWay,
+      ESearchEngine::ZFunction};
+  std::mt19937_64 generator(42);
+  for (int i = 0; i < 300; ++i) {
+    const std::uint64_t alpha_size = generator() % 3 + 1;
+    const std::string pattern =
+        randomString(generator, generator() % 12 + 1, alpha_size);
+    const std::string text =
+        randomString(generator, generator() % 300, alpha_size);
+    for (const ESearchEngine engine : engines) {
+      const TSubstrSearcher searcher(pattern, engine);
+      EXPECT_EQ(searcher.engine(), engine);
+      expectNaiveEquality(searcher, text);
+    }
+    expectVectorEquality(substrSearch(text, pattern),
+                         naiveSearch(text, pattern));
+  }
+}
+
+TEST(SubstrSearcher, EnginesSimple) {
+  const std::vector<ESearchEngine> engines = {
+      ESearchEngine::Simd, ESearchEngine::Horspool, ESearchEngine::TwoWay,
+      ESearchEngine::ZFunction};
+  for (const ESearchEngine engine : engines) {
+    const TSubstrSearcher searcher("abab", engine);
+    EXPECT_EQ(searcher.pattern(), "abab");
+    expectVectorEquality(searcher.findAll("abababxabab"), {0, 2, 7});
+    EXPECT_EQ(searcher.findFirst("xxabab"), 2);
+    EXPECT_EQ(searcher.count("aba"), 0);
+    EXPECT_THROW(TSubstrSearcher("", engine), std::range_error);
+  }
+  // Critical factorizations of non-periodic patterns with long borders
+  for (const std::string pattern : {"abaabaab", "zzzyzzz", "ba", "aab"}) {
+    expectNaiveEquality(TTwoWaySearcher(pattern),
+                        pattern + pattern + "x" + pattern.substr(1) + pattern);
+  }
+  EXPECT_THROW(static_cast<void>(substrSearch("abc", "")), std::range_error);
+}
+
+TEST(SubstrSearcher, SelectEngine) {
+  const std::string long_pattern = "the quick brown fox jumps over the lazy "
+                                   "dog and keeps running far away";
+  const std::string periodic_pattern(100, 'a');
+  EXPECT_EQ(selectEngine("abc", true), ESearchEngine::Simd);
+  EXPECT_EQ(selectEngine("ACGTTGCA", true), ESearchEngine::Simd);
+  EXPECT_EQ(selectEngine(long_pattern, true), ESearchEngine::Simd);
+  EXPECT_EQ(selectEngine(periodic_pattern, true), ESearchEngine::Simd);
+  EXPECT_EQ(selectEngine("quick fox", false), ESearchEngine::Simd);
+  EXPECT_EQ(selectEngine("ACGTTGCA", false), ESearchEngine::Horspool);
+  EXPECT_EQ(selectEngine("ACACACAC", false), ESearchEngine::TwoWay);
+  EXPECT_EQ(selectEngine(long_pattern, false), ESearchEngine::Horspool);
+  EXPECT_EQ(selectEngine(periodic_pattern, false), ESearchEngine::TwoWay);
+  EXPECT_EQ(TSubstrSearcher("abc").engine(),
+            selectEngine("abc", hasVectorFilter()));
+}
+
+// a^k b a^k is not periodic and has 2 distinct chars, so it goes to Horspool
+// without the vector filter. Every window of a^n compares k chars and shifts
+// by 1, the budget leaves the text to the automaton
+TEST(SubstrSearcher, HorspoolAdversarialPattern) {
+  const std::string pattern = std::string(1000, 'a') + 'b' +
+                              std::string(1000, 'a');
+  const ESearchEngine engine = selectEngine(pattern, false);
+  EXPECT_EQ(engine, ESearchEngine::Horspool);
+  const TSubstrSearcher searcher(pattern, engine);
+  EXPECT_EQ(searcher.count(std::string(1ULL << 20, 'a')), 0);
+  const std::string text = std::string(20'000, 'a') + 'b' +
+                           std::string(20'000, 'a');
+  expectVectorEquality(searcher.findAll(text), {19'000});
+  EXPECT_EQ(searcher.findFirst(text), 19'000);
+  EXPECT_EQ(searcher.count(text), 1);
+}
+
+int main(int argc, char* argv[]) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -1,3 +1,5 @@
+#include <span>
+#include <string_view>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -42,6 +44,41 @@ TEST(AhoCorasickAutomata, SimpleTest) {
   expectSetEquality(automata.findAllOccurrences(text), expected_occurrences);
 }
 
+TEST(AhoCorasickAutomata, ByteSpanText) {
+  TLetterAhoCorasick automata;
+  automata.addString("he");
+  automata.addString("she");
+  const std::string text = "ushers";
+  std::unordered_map<std::size_t, std::unordered_set<std::size_t>>
+      expected_occurrences;
+  expected_occurrences[2].insert(0);
+  expected_occurrences[1].insert(1);
+  expectSetEquality(
+      automata.findAllOccurrences(std::as_bytes(std::span(text))),
+      expected_occurrences);
+  expectSetEquality(
+      automata.findAllOccurrences(std::string_view(text).substr(1, 3)),
+      {{0, {1}}, {1, {0}}});
+}
+
+TEST(AhoCorasickAutomata, OutOfAlphabetChars) {
+  TLetterAhoCorasick automata;
+  automata.addString("he");
+  automata.addString("hers");
+  const std::string text("he\nhe rs\xFFhers\0he", 16);
+  std::unordered_map<std::size_t, std::unordered_set<std::size_t>>
+      expected_occurrences;
+  expected_occurrences[0].insert(0);
+  expected_occurrences[3].insert(0);
+  expected_occurrences[9].insert(0);
+  expected_occurrences[9].insert(1);
+  expected_occurrences[14].insert(0);
+  expectSetEquality(automata.findAllOccurrences(text), expected_occurrences);
+  expectSetEquality(
+      automata.findAllOccurrences(std::as_bytes(std::span(text))),
+      expected_occurrences);
+}
+
 int main(int argc, char* argv[]) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();